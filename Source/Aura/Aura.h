@@ -7,3 +7,5 @@
 #define CUSTOM_DEPTH_RED 250
 #define ECC_Projectile ECollisionChannel::ECC_GameTraceChannel1
 #define ECC_Target ECollisionChannel::ECC_GameTraceChannel2
+
+DECLARE_STATS_GROUP(TEXT("Aura"), STATGROUP_Aura, STATCAT_Advanced);
@@ -3,7 +3,7 @@
 
 #include "AI/AuraAIController.h"
 
-#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "AI/AuraBehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 
 AAuraAIController::AAuraAIController()
@@ -11,6 +11,7 @@ AAuraAIController::AAuraAIController()
 	Blackboard = CreateDefaultSubobject<UBlackboardComponent>("BlackboardComponent");
 	check(Blackboard);
 
-	BehaviorTreeComponent = CreateDefaultSubobject<UBehaviorTreeComponent>("BehaviorTreeComponent");
+	BehaviorTreeComponent = CreateDefaultSubobject<UAuraBehaviorTreeComponent>("BehaviorTreeComponent");
 	check(BehaviorTreeComponent);
+	BrainComponent = BehaviorTreeComponent;
 }
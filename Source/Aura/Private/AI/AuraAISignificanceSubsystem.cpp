@@ -0,0 +1,122 @@
+// Copyright - Amey Chavan
+
+
+#include "AI/AuraAISignificanceSubsystem.h"
+
+#include "Aura/Aura.h"
+#include "Character/AuraEnemy.h"
+#include "Interaction/CombatInterface.h"
+
+DECLARE_CYCLE_STAT(TEXT("Update AI Significance"), STAT_AuraUpdateAISignificance, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI Significance High"), STAT_AuraAISignificanceHigh, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI Significance Medium"), STAT_AuraAISignificanceMedium, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI Significance Low"), STAT_AuraAISignificanceLow, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI Significance Dormant"), STAT_AuraAISignificanceDormant, STATGROUP_Aura);
+
+void UAuraAISignificanceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate < UpdateInterval) return;
+	TimeSinceUpdate = 0.0f;
+
+	UpdateSignificance();
+}
+
+bool UAuraAISignificanceSubsystem::IsTickable() const
+{
+	return !Enemies.IsEmpty();
+}
+
+TStatId UAuraAISignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraAISignificanceSubsystem, STATGROUP_Aura);
+}
+
+void UAuraAISignificanceSubsystem::RegisterEnemy(AAuraEnemy* Enemy)
+{
+	if (!IsValid(Enemy)) return;
+
+	Enemies.AddUnique(Enemy);
+}
+
+void UAuraAISignificanceSubsystem::UnregisterEnemy(AAuraEnemy* Enemy)
+{
+	/** Only stops the updates, whatever state the enemy ends up in (e.g. when dying) is up to the enemy itself. */
+	Enemies.RemoveSingleSwap(Enemy, false);
+}
+
+void UAuraAISignificanceSubsystem::UpdateSignificance()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraUpdateAISignificance);
+
+	TArray<FVector, TInlineAllocator<8>> PlayerLocations;
+	for (FConstPlayerControllerIterator PlayerControllerIterator = GetWorld()->GetPlayerControllerIterator(); PlayerControllerIterator; ++PlayerControllerIterator)
+	{
+		const APawn* PlayerPawn = PlayerControllerIterator->Get() ? PlayerControllerIterator->Get()->GetPawn() : nullptr;
+		if (!IsValid(PlayerPawn)) continue;
+
+		if (PlayerPawn->Implements<UCombatInterface>() && ICombatInterface::Execute_IsDead(PlayerPawn)) continue;
+
+		PlayerLocations.Add(PlayerPawn->GetActorLocation());
+	}
+
+	/**
+	 * Without a live player (e.g. all of them dead & waiting to respawn, or still loading in) every enemy would be
+	 * bucketed as `Dormant`, and a returning player would find them all asleep. Keep the current buckets instead.
+	 */
+	if (PlayerLocations.IsEmpty()) return;
+
+	int32 BucketCounts[static_cast<uint8>(EAuraAISignificance::MAX)] = {};
+
+	for (int32 Index = Enemies.Num() - 1; Index >= 0; --Index)
+	{
+		AAuraEnemy* Enemy = Enemies[Index].Get();
+		if (!IsValid(Enemy))
+		{
+			Enemies.RemoveAtSwap(Index, 1, false);
+			continue;
+		}
+
+		const EAuraAISignificance Significance = CalculateSignificance(Enemy, PlayerLocations);
+		Enemy->SetAISignificance(Significance);
+
+		++BucketCounts[static_cast<uint8>(Significance)];
+	}
+
+	SET_DWORD_STAT(STAT_AuraAISignificanceHigh, BucketCounts[static_cast<uint8>(EAuraAISignificance::High)]);
+	SET_DWORD_STAT(STAT_AuraAISignificanceMedium, BucketCounts[static_cast<uint8>(EAuraAISignificance::Medium)]);
+	SET_DWORD_STAT(STAT_AuraAISignificanceLow, BucketCounts[static_cast<uint8>(EAuraAISignificance::Low)]);
+	SET_DWORD_STAT(STAT_AuraAISignificanceDormant, BucketCounts[static_cast<uint8>(EAuraAISignificance::Dormant)]);
+}
+
+EAuraAISignificance UAuraAISignificanceSubsystem::CalculateSignificance(const AAuraEnemy* Enemy, TConstArrayView<FVector> PlayerLocations) const
+{
+	const FVector EnemyLocation = Enemy->GetActorLocation();
+
+	double NearestDistanceSquared = TNumericLimits<double>::Max();
+	for (const FVector& PlayerLocation : PlayerLocations)
+	{
+		NearestDistanceSquared = FMath::Min(NearestDistanceSquared, FVector::DistSquared(EnemyLocation, PlayerLocation));
+	}
+
+	static_assert(UE_ARRAY_COUNT(BucketMaxDistances) == static_cast<uint8>(EAuraAISignificance::Dormant), "Every bucket but Dormant needs a maximum distance.");
+
+	uint8 Bucket = static_cast<uint8>(EAuraAISignificance::Dormant);
+	for (uint8 Index = 0; Index < UE_ARRAY_COUNT(BucketMaxDistances); ++Index)
+	{
+		if (NearestDistanceSquared <= FMath::Square(BucketMaxDistances[Index]))
+		{
+			Bucket = Index;
+			break;
+		}
+	}
+
+	if (Enemy->WasRecentlyRendered(UpdateInterval * 2.0f))
+	{
+		Bucket = FMath::Min(Bucket, static_cast<uint8>(RenderedSignificance));
+	}
+
+	return static_cast<EAuraAISignificance>(Bucket);
+}
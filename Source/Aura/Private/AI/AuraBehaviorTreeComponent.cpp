@@ -0,0 +1,33 @@
+// Copyright - Amey Chavan
+
+
+#include "AI/AuraBehaviorTreeComponent.h"
+
+void UAuraBehaviorTreeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	ApplyMinTickInterval();
+}
+
+void UAuraBehaviorTreeComponent::SetMinTickInterval(float NewMinTickInterval)
+{
+	MinTickInterval = FMath::Max(NewMinTickInterval, 0.0f);
+
+	ApplyMinTickInterval();
+}
+
+void UAuraBehaviorTreeComponent::ApplyMinTickInterval()
+{
+	/** A tree with nothing to do until an execution request disables its tick, leave it that way. */
+	if (MinTickInterval <= 0.0f || !IsComponentTickEnabled()) return;
+
+	/**
+	 * The tick function passes the time elapsed since the previous tick, which the tree subtracts from the time it asked
+	 * to wait for. So stretching the interval here just makes the tree catch up on the next tick.
+	 */
+	if (GetComponentTickInterval() < MinTickInterval)
+	{
+		SetComponentTickIntervalAndCooldown(MinTickInterval);
+	}
+}
@@ -0,0 +1,66 @@
+// Copyright - Amey Chavan
+
+
+#include "AI/AuraSplinePathFollower.h"
+
+#include "Aura/Aura.h"
+#include "Components/SplineComponent.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spline Follower Full Searches"), STAT_AuraSplineFollowerFullSearches, STATGROUP_Aura);
+
+void FAuraSplinePathFollower::Reset()
+{
+	CurrentInputKey = 0.0f;
+}
+
+void FAuraSplinePathFollower::Update(const USplineComponent& Spline, const FVector& WorldLocation,
+	FVector& OutLocationOnSpline, FVector& OutDirection)
+{
+	const FInterpCurveVector& PositionCurve = Spline.SplineCurves.Position;
+	const int32 NumPoints = PositionCurve.Points.Num();
+	const int32 NumSegments = PositionCurve.bIsLooped ? NumPoints : NumPoints - 1;
+
+	if (NumSegments > 0)
+	{
+		/** The spline curves are in the component's local space. */
+		const FVector LocalLocation = Spline.GetComponentTransform().InverseTransformPosition(WorldLocation);
+
+		const int32 FirstSegment = FMath::Clamp(FMath::FloorToInt32(CurrentInputKey), 0, NumSegments - 1);
+		const int32 LastSegment = FMath::Min(FirstSegment + LookAheadSegments, NumSegments - 1);
+
+		float BestInputKey = CurrentInputKey;
+		float BestDistanceSquared = TNumericLimits<float>::Max();
+		for (int32 Segment = FirstSegment; Segment <= LastSegment; ++Segment)
+		{
+			float DistanceSquared = 0.0f;
+			float InputKey = PositionCurve.InaccurateFindNearestOnSegment(LocalLocation, Segment, DistanceSquared);
+
+			/**
+			 * Never go back along the path. The closest point behind the current key means the follower is still around
+			 * the current key (e.g. it hasn't moved yet), so that one is the candidate rather than skipping the segment.
+			 */
+			if (InputKey < CurrentInputKey)
+			{
+				InputKey = CurrentInputKey;
+				DistanceSquared = FVector::DistSquared(PositionCurve.Eval(CurrentInputKey, FVector::ZeroVector), LocalLocation);
+			}
+
+			if (DistanceSquared < BestDistanceSquared)
+			{
+				BestDistanceSquared = DistanceSquared;
+				BestInputKey = InputKey;
+			}
+		}
+
+		if (BestDistanceSquared > FMath::Square(MaxDeviation))
+		{
+			BestInputKey = Spline.FindInputKeyClosestToWorldLocation(WorldLocation);
+			INC_DWORD_STAT(STAT_AuraSplineFollowerFullSearches);
+		}
+
+		CurrentInputKey = BestInputKey;
+	}
+
+	OutLocationOnSpline = Spline.GetLocationAtSplineInputKey(CurrentInputKey, ESplineCoordinateSpace::World);
+	OutDirection = Spline.GetDirectionAtSplineInputKey(CurrentInputKey, ESplineCoordinateSpace::World);
+}
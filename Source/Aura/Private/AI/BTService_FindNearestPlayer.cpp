@@ -0,0 +1,90 @@
+// Copyright - Amey Chavan
+
+
+#include "AI/BTService_FindNearestPlayer.h"
+
+#include "AIController.h"
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "Aura/Aura.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Float.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "Game/AuraCombatantGridSubsystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Find Nearest Player"), STAT_AuraFindNearestPlayer, STATGROUP_Aura);
+
+UBTService_FindNearestPlayer::UBTService_FindNearestPlayer()
+{
+	NodeName = TEXT("Find Nearest Player");
+
+	bNotifyBecomeRelevant = false;
+	bNotifyCeaseRelevant = false;
+
+	TargetToFollowSelector.AddObjectFilter(this, GET_MEMBER_NAME_CHECKED(UBTService_FindNearestPlayer, TargetToFollowSelector), AActor::StaticClass());
+	DistanceToTargetSelector.AddFloatFilter(this, GET_MEMBER_NAME_CHECKED(UBTService_FindNearestPlayer, DistanceToTargetSelector));
+}
+
+void UBTService_FindNearestPlayer::InitializeFromAsset(UBehaviorTree& Asset)
+{
+	Super::InitializeFromAsset(Asset);
+
+	/** Resolve the key IDs once for the tree asset, so ticking doesn't look them up by name. */
+	if (const UBlackboardData* BlackboardAsset = GetBlackboardAsset())
+	{
+		TargetToFollowSelector.ResolveSelectedKey(*BlackboardAsset);
+		DistanceToTargetSelector.ResolveSelectedKey(*BlackboardAsset);
+	}
+}
+
+void UBTService_FindNearestPlayer::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
+{
+	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
+
+	SCOPE_CYCLE_COUNTER(STAT_AuraFindNearestPlayer);
+
+	const AAIController* AIOwner = OwnerComp.GetAIOwner();
+	const APawn* OwningPawn = AIOwner ? AIOwner->GetPawn() : nullptr;
+	UBlackboardComponent* BlackboardComponent = OwnerComp.GetBlackboardComponent();
+	if (OwningPawn == nullptr || BlackboardComponent == nullptr) return;
+
+	double ClosestDistanceSquared = 0.0;
+	AActor* ClosestActor = FindNearestTarget(*OwningPawn, ClosestDistanceSquared);
+
+	BlackboardComponent->SetValue<UBlackboardKeyType_Object>(TargetToFollowSelector.GetSelectedKeyID(), ClosestActor);
+
+	if (ClosestActor)
+	{
+		BlackboardComponent->SetValue<UBlackboardKeyType_Float>(DistanceToTargetSelector.GetSelectedKeyID(), FMath::Sqrt(ClosestDistanceSquared));
+	}
+	else
+	{
+		/** Don't leave the distance to the previous target behind for the decorators. */
+		BlackboardComponent->ClearValue(DistanceToTargetSelector.GetSelectedKeyID());
+	}
+}
+
+AActor* UBTService_FindNearestPlayer::FindNearestTarget(const APawn& OwningPawn, double& OutDistanceSquared)
+{
+	const UAuraCombatantGridSubsystem* CombatantGrid = OwningPawn.GetWorld()->GetSubsystem<UAuraCombatantGridSubsystem>();
+	if (CombatantGrid == nullptr) return nullptr;
+
+	/** Same as the Blueprint service, the players target the enemies & everyone else targets the players. */
+	const EAuraTeam TargetTeam = UAuraAbilitySystemLibrary::GetActorTeam(&OwningPawn) == EAuraTeam::Player ? EAuraTeam::Enemy : EAuraTeam::Player;
+
+	const FVector OwnerLocation = OwningPawn.GetActorLocation();
+
+	AActor* ClosestActor = nullptr;
+	double ClosestDistanceSquared = TNumericLimits<double>::Max();
+	for (const FAuraCombatantLocation& Target : CombatantGrid->GetLiveCombatantsOfTeam(TargetTeam))
+	{
+		const double DistanceSquared = FVector::DistSquared(OwnerLocation, Target.Location);
+		if (DistanceSquared < ClosestDistanceSquared)
+		{
+			ClosestDistanceSquared = DistanceSquared;
+			ClosestActor = Target.Combatant;
+		}
+	}
+
+	OutDistanceSquared = ClosestDistanceSquared;
+	return ClosestActor;
+}
@@ -5,6 +5,7 @@
 
 #include "AbilitySystem/AuraAbilitySystemLibrary.h"
 #include "GameFramework/Character.h"
+#include "TimerManager.h"
 #include "Kismet/KismetSystemLibrary.h"
 
 void UAuraBeamSpell::StoreMouseDataInfo(const FHitResult& HitResult)
@@ -104,40 +105,35 @@ void UAuraBeamSpell::StoreAdditionalTargets(TArray<AActor*>& OutAdditionalTarget
 	ActorsToIgnore.Add(GetAvatarActorFromActorInfo());
 	ActorsToIgnore.Add(MouseHitActor);
 
+	/**
+	 * Only collect the enemies of the ability's 'Avatar Actor' and not the other players,
+	 * this is mainly to show the beam targeted only towards the enemies.
+	 */
 	TArray<AActor*> OverlappingActors;
-	UAuraAbilitySystemLibrary::GetLivePlayersWithinRadius(
+	TArray<FVector> OverlappingActorLocations;
+	UAuraAbilitySystemLibrary::GetLiveHostilesWithLocationsWithinRadius(
 		GetAvatarActorFromActorInfo(),
 		OverlappingActors,
+		OverlappingActorLocations,
 		ActorsToIgnore,
 		850.0f,
-		MouseHitActor->GetActorLocation()
+		MouseHitActor->GetActorLocation(),
+		GetAvatarActorFromActorInfo()
 	);
 
-	/** Remove the other players if there are any in `OverlappingActors`. */
-	for (int32 Index = OverlappingActors.Num() - 1; Index >= 0; --Index)
-	{
-		/**
-		 * If the 'Overlapping Actor' and the ability's 'Avatar Actor' are NOT friends then it means they're enemies.
-		 * But since we want to check whether they both are friends, we again NEGATE that result to know whether they're friends.
-		 *
-		 * This is mainly to show the beam targeted only towards the enemies and not the other players.
-		 */
-		if (!UAuraAbilitySystemLibrary::IsNotFriend(OverlappingActors[Index], GetAvatarActorFromActorInfo()))
-		{
-			OverlappingActors.RemoveAt(Index);
-		}
-	}
-
 	const int32 NumAdditionalTargets = FMath::Min(GetAbilityLevel() - 1, MaxNumShockTargets);
 	// int32 NumAdditionalTargets = 5;
 
-	UAuraAbilitySystemLibrary::GetClosestTargets(
+	UAuraAbilitySystemLibrary::SelectClosestTargets(
 		NumAdditionalTargets,
 		OverlappingActors,
+		OverlappingActorLocations,
 		OutAdditionalTargets,
 		MouseHitActor->GetActorLocation()
 	);
 
+	AdditionalTargets = OutAdditionalTargets;
+
 	for (AActor* Target : OutAdditionalTargets)
 	{
 		if (ICombatInterface* CombatInterface = Cast<ICombatInterface>(Target))
@@ -149,3 +145,39 @@ void UAuraBeamSpell::StoreAdditionalTargets(TArray<AActor*>& OutAdditionalTarget
 		}
 	}
 }
+
+void UAuraBeamSpell::CauseDamageToBeamTargets()
+{
+	TArray<AActor*> Targets;
+	Targets.Reserve(AdditionalTargets.Num() + 1);
+	Targets.Add(MouseHitActor);
+	Targets.Append(AdditionalTargets);
+
+	/** Targets which died since they were stored are skipped, their death delegates end the beam on them anyway. */
+	Targets.RemoveAllSwap([](const AActor* Target)
+	{
+		return !IsValid(Target) || (Target->Implements<UCombatInterface>() && ICombatInterface::Execute_IsDead(Target));
+	}, false);
+
+	CauseDamageToTargets(Targets);
+}
+
+void UAuraBeamSpell::StartBeamDamage()
+{
+	if (!HasAuthority(&CurrentActivationInfo)) return;
+
+	CauseDamageToBeamTargets();
+
+	GetWorld()->GetTimerManager().SetTimer(BeamDamageTimerHandle, this, &UAuraBeamSpell::CauseDamageToBeamTargets, BeamDamageInterval, true);
+}
+
+void UAuraBeamSpell::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
+{
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(BeamDamageTimerHandle);
+	}
+
+	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
+}
@@ -5,6 +5,7 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
 
 void UAuraDamageGameplayAbility::CauseDamage(AActor* TargetActor)
 {
@@ -19,6 +20,20 @@ void UAuraDamageGameplayAbility::CauseDamage(AActor* TargetActor)
 	);
 }
 
+void UAuraDamageGameplayAbility::CauseDamageToTargets(const TArray<AActor*>& TargetActors)
+{
+	TArray<UAbilitySystemComponent*, TInlineAllocator<16>> TargetASCs;
+	for (AActor* TargetActor : TargetActors)
+	{
+		if (UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor))
+		{
+			TargetASCs.Add(TargetASC);
+		}
+	}
+
+	UAuraAbilitySystemLibrary::ApplyDamageEffectToTargets(MakeDamageEffectParamsFromClassDefaults(), TargetASCs);
+}
+
 FDamageEffectParams UAuraDamageGameplayAbility::MakeDamageEffectParamsFromClassDefaults(AActor* TargetActor) const
 {
 	FDamageEffectParams Params;
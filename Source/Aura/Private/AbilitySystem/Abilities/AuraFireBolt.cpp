@@ -5,7 +5,8 @@
 
 #include "AbilitySystem/AuraAbilitySystemLibrary.h"
 #include "Actor/AuraProjectile.h"
-#include "GameFramework/ProjectileMovementComponent.h"
+#include "Actor/AuraProjectileMovementComponent.h"
+#include "Actor/AuraProjectilePoolSubsystem.h"
 
 
 FString UAuraFireBolt::GetDescription(int32 Level)
@@ -144,18 +145,19 @@ void UAuraFireBolt::SpawnProjectiles(const FVector& ProjectileTargetLocation, co
 		EffectiveNumProjectiles
 	);
 
+	UAuraProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UAuraProjectilePoolSubsystem>();
+
 	for (const FRotator& Rot : Rotations)
 	{
 		FTransform SpawnTransform;
 		SpawnTransform.SetLocation(SocketLocation);
 		SpawnTransform.SetRotation(Rot.Quaternion());
 
-		AAuraProjectile* Projectile = GetWorld()->SpawnActorDeferred<AAuraProjectile>(
+		AAuraProjectile* Projectile = ProjectilePool->AcquireProjectile(
 			ProjectileClass,
 			SpawnTransform,
 			GetOwningActorFromActorInfo(),
-			Cast<APawn>(GetOwningActorFromActorInfo()),
-			ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+			Cast<APawn>(GetOwningActorFromActorInfo())
 		);
 
 		Projectile->DamageEffectParams = MakeDamageEffectParamsFromClassDefaults();
@@ -166,14 +168,13 @@ void UAuraFireBolt::SpawnProjectiles(const FVector& ProjectileTargetLocation, co
 		}
 		else
 		{
-			Projectile->HomingTargetSceneComponent = NewObject<USceneComponent>(USceneComponent::StaticClass());
-			Projectile->HomingTargetSceneComponent->SetWorldLocation(ProjectileTargetLocation);
-			Projectile->ProjectileMovement->HomingTargetComponent = Projectile->HomingTargetSceneComponent;
+			/** Home towards the clicked location itself, without allocating a scene component per projectile. */
+			Projectile->ProjectileMovement->SetHomingTargetLocation(ProjectileTargetLocation);
 		}
 
 		Projectile->ProjectileMovement->HomingAccelerationMagnitude = FMath::FRandRange(HomingAccelerationMin, HomingAccelerationMax);
 		Projectile->ProjectileMovement->bIsHomingProjectile = bLaunchHomingProjectiles;
 
-		Projectile->FinishSpawning(SpawnTransform);
+		ProjectilePool->LaunchProjectile(Projectile, SpawnTransform);
 	}
 }
@@ -6,6 +6,7 @@
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
 #include "Actor/AuraProjectile.h"
+#include "Actor/AuraProjectilePoolSubsystem.h"
 #include "Interaction/CombatInterface.h"
 
 
@@ -36,14 +37,15 @@ void UAuraProjectileSpell::SpawnProjectile(const FVector& ProjectileTargetLocati
 	SpawnTransform.SetLocation(SocketLocation);
 	SpawnTransform.SetRotation(Rotation.Quaternion());
 
-	AAuraProjectile* Projectile = GetWorld()->SpawnActorDeferred<AAuraProjectile>(
+	UAuraProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UAuraProjectilePoolSubsystem>();
+
+	AAuraProjectile* Projectile = ProjectilePool->AcquireProjectile(
 		ProjectileClass,
 		SpawnTransform,
 		GetOwningActorFromActorInfo(),
-		Cast<APawn>(GetOwningActorFromActorInfo()),
-		ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+		Cast<APawn>(GetOwningActorFromActorInfo())
 	);
 
 	Projectile->DamageEffectParams = MakeDamageEffectParamsFromClassDefaults();
-	Projectile->FinishSpawning(SpawnTransform);
+	ProjectilePool->LaunchProjectile(Projectile, SpawnTransform);
 }
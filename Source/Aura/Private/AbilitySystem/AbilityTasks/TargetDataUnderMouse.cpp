@@ -4,6 +4,7 @@
 #include "AbilitySystem/AbilityTasks/TargetDataUnderMouse.h"
 #include "AbilitySystemComponent.h"
 #include "Aura/Aura.h"
+#include "Player/AuraPlayerController.h"
 
 UTargetDataUnderMouse* UTargetDataUnderMouse::CreateTargetDataUnderMouse(UGameplayAbility* OwningAbility)
 {
@@ -45,7 +46,16 @@ void UTargetDataUnderMouse::SendMouseCursorData()
 
 	APlayerController* PC = Ability->GetCurrentActorInfo()->PlayerController.Get();
 	FHitResult CursorHit;
-	PC->GetHitResultUnderCursor(ECC_Target, false, CursorHit);
+
+	/** Reuse the cursor hit cached by the player controller if the mouse & camera didn't move since it was traced. */
+	if (AAuraPlayerController* AuraPC = Cast<AAuraPlayerController>(PC))
+	{
+		CursorHit = AuraPC->GetCachedHitResultUnderCursor(ECC_Target);
+	}
+	else
+	{
+		PC->GetHitResultUnderCursor(ECC_Target, false, CursorHit);
+	}
 
 	FGameplayAbilityTargetDataHandle DataHandle;
 	FGameplayAbilityTargetData_SingleTargetHit* Data = new FGameplayAbilityTargetData_SingleTargetHit();
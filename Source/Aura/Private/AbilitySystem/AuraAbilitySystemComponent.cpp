@@ -8,9 +8,14 @@
 #include "AbilitySystem/AuraAbilitySystemLibrary.h"
 #include "AbilitySystem/Abilities/AuraGameplayAbility.h"
 #include "AbilitySystem/Data/AbilityInfo.h"
+#include "Aura/Aura.h"
 #include "Aura/AuraLogChannels.h"
 #include "Interaction/PlayerInterface.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ability Input Events"), STAT_AuraAbilityInputEvents, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ability Input Specs Visited"), STAT_AuraAbilityInputSpecsVisited, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ability Input Specs Visited (Full Scan)"), STAT_AuraAbilityInputSpecsFullScan, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ability Spec Index Specs Scanned"), STAT_AuraAbilitySpecIndexSpecsScanned, STATGROUP_Aura);
 
 void UAuraAbilitySystemComponent::AbilityActorInfoSet()
 {
@@ -51,19 +56,22 @@ void UAuraAbilitySystemComponent::AbilityInputTagPressed(const FGameplayTag& Inp
 {
 	if (!InputTag.IsValid()) return;
 
+	TArray<FGameplayAbilitySpecHandle, TInlineAllocator<4>> Handles;
+	GetSpecHandlesWithInputTag(InputTag, Handles);
+
 	FScopedAbilityListLock ActiveScopeLock(*this);
 
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	for (const FGameplayAbilitySpecHandle& Handle : Handles)
 	{
-		if (AbilitySpec.DynamicAbilityTags.HasTagExact(InputTag))
+		if (FGameplayAbilitySpec* AbilitySpec = GetIndexedSpec(Handle))
 		{
-			AbilitySpecInputPressed(AbilitySpec);
-			if (AbilitySpec.IsActive())
+			AbilitySpecInputPressed(*AbilitySpec);
+			if (AbilitySpec->IsActive())
 			{
 				InvokeReplicatedEvent(
 					EAbilityGenericReplicatedEvent::InputPressed,
-					AbilitySpec.Handle,
-					AbilitySpec.ActivationInfo.GetActivationPredictionKey()
+					AbilitySpec->Handle,
+					AbilitySpec->ActivationInfo.GetActivationPredictionKey()
 				);
 			}
 		}
@@ -74,16 +82,19 @@ void UAuraAbilitySystemComponent::AbilityInputTagHeld(const FGameplayTag& InputT
 {
 	if (!InputTag.IsValid()) return;
 
+	TArray<FGameplayAbilitySpecHandle, TInlineAllocator<4>> Handles;
+	GetSpecHandlesWithInputTag(InputTag, Handles);
+
 	FScopedAbilityListLock ActiveScopeLock(*this);
 
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	for (const FGameplayAbilitySpecHandle& Handle : Handles)
 	{
-		if (AbilitySpec.DynamicAbilityTags.HasTagExact(InputTag))
+		if (FGameplayAbilitySpec* AbilitySpec = GetIndexedSpec(Handle))
 		{
-			AbilitySpecInputPressed(AbilitySpec);
-			if (!AbilitySpec.IsActive())
+			AbilitySpecInputPressed(*AbilitySpec);
+			if (!AbilitySpec->IsActive())
 			{
-				TryActivateAbility(AbilitySpec.Handle);
+				TryActivateAbility(AbilitySpec->Handle);
 			}
 		}
 	}
@@ -93,17 +104,21 @@ void UAuraAbilitySystemComponent::AbilityInputTagReleased(const FGameplayTag& In
 {
 	if (!InputTag.IsValid()) return;
 
+	TArray<FGameplayAbilitySpecHandle, TInlineAllocator<4>> Handles;
+	GetSpecHandlesWithInputTag(InputTag, Handles);
+
 	FScopedAbilityListLock ActiveScopeLock(*this);
 
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	for (const FGameplayAbilitySpecHandle& Handle : Handles)
 	{
-		if (AbilitySpec.DynamicAbilityTags.HasTagExact(InputTag) && AbilitySpec.IsActive())
+		FGameplayAbilitySpec* AbilitySpec = GetIndexedSpec(Handle);
+		if (AbilitySpec && AbilitySpec->IsActive())
 		{
-			AbilitySpecInputReleased(AbilitySpec);
+			AbilitySpecInputReleased(*AbilitySpec);
 			InvokeReplicatedEvent(
 				EAbilityGenericReplicatedEvent::InputReleased,
-				AbilitySpec.Handle,
-				AbilitySpec.ActivationInfo.GetActivationPredictionKey()
+				AbilitySpec->Handle,
+				AbilitySpec->ActivationInfo.GetActivationPredictionKey()
 			);
 		}
 	}
@@ -121,8 +136,12 @@ void UAuraAbilitySystemComponent::ForEachAbility(const FForEachAbility& Delegate
 	 * This ensures that the activatable abilities list will be locked and it will keep track of any abilities
 	 * that are attempted to be removed or added, and wait until this scope has finished before mutating that list.
 	 * This gives us a safe way to do it.
+	 *
+	 * The ability spec index is brought up to date first, so the delegates can use the cached `Get*FromSpec()` getters.
 	 */
 
+	RebuildAbilitySpecIndexIfDirty();
+
 	FScopedAbilityListLock ActiveScopeLock(*this);
 
 	for (const FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
@@ -139,43 +158,31 @@ void UAuraAbilitySystemComponent::ForEachAbility(const FForEachAbility& Delegate
 	}
 }
 
-FGameplayTag UAuraAbilitySystemComponent::GetAbilityTagFromSpec(const FGameplayAbilitySpec& AbilitySpec)
+FGameplayTag UAuraAbilitySystemComponent::GetAbilityTagFromSpec(const FGameplayAbilitySpec& AbilitySpec) const
 {
-	if (IsValid(AbilitySpec.Ability))
+	if (const FAbilitySpecIndexEntry* Entry = FindAbilitySpecIndexEntry(AbilitySpec))
 	{
-		for (FGameplayTag Tag : AbilitySpec.Ability.Get()->AbilityTags)
-		{
-			if (Tag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("Abilities"))))
-			{
-				return Tag;
-			}
-		}
+		return Entry->AbilityTag;
 	}
-	return FGameplayTag();
+	return FindAbilityTagInSpec(AbilitySpec);
 }
 
-FGameplayTag UAuraAbilitySystemComponent::GetInputTagFromSpec(const FGameplayAbilitySpec& AbilitySpec)
+FGameplayTag UAuraAbilitySystemComponent::GetInputTagFromSpec(const FGameplayAbilitySpec& AbilitySpec) const
 {
-	for (FGameplayTag Tag : AbilitySpec.DynamicAbilityTags)
+	if (const FAbilitySpecIndexEntry* Entry = FindAbilitySpecIndexEntry(AbilitySpec))
 	{
-		if (Tag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("InputTag"))))
-		{
-			return Tag;
-		}
+		return Entry->InputTag;
 	}
-	return FGameplayTag();
+	return FindInputTagInSpec(AbilitySpec);
 }
 
-FGameplayTag UAuraAbilitySystemComponent::GetStatusFromSpec(const FGameplayAbilitySpec& AbilitySpec)
+FGameplayTag UAuraAbilitySystemComponent::GetStatusFromSpec(const FGameplayAbilitySpec& AbilitySpec) const
 {
-	for (FGameplayTag StatusTag : AbilitySpec.DynamicAbilityTags)
+	if (const FAbilitySpecIndexEntry* Entry = FindAbilitySpecIndexEntry(AbilitySpec))
 	{
-		if (StatusTag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("Abilities.Status"))))
-		{
-			return StatusTag;
-		}
+		return Entry->StatusTag;
 	}
-	return FGameplayTag();
+	return FindStatusInSpec(AbilitySpec);
 }
 
 FGameplayTag UAuraAbilitySystemComponent::GetStatusFromAbilityTag(const FGameplayTag& AbilityTag)
@@ -198,16 +205,9 @@ FGameplayTag UAuraAbilitySystemComponent::GetSlotFromAbilityTag(const FGameplayT
 
 bool UAuraAbilitySystemComponent::SlotIsEmpty(const FGameplayTag& Slot)
 {
-	FScopedAbilityListLock ActiveScopeLock(*this);
+	RebuildAbilitySpecIndexIfDirty();
 
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
-	{
-		if (AbilityHasSlot(AbilitySpec, Slot))
-		{
-			return false;
-		}
-	}
-	return true;
+	return !InputTagToSpecHandles.Contains(Slot);
 }
 
 bool UAuraAbilitySystemComponent::AbilityHasSlot(const FGameplayAbilitySpec& Spec, const FGameplayTag& Slot)
@@ -215,38 +215,29 @@ bool UAuraAbilitySystemComponent::AbilityHasSlot(const FGameplayAbilitySpec& Spe
 	return Spec.DynamicAbilityTags.HasTagExact(Slot);
 }
 
-bool UAuraAbilitySystemComponent::AbilityHasAnySlot(const FGameplayAbilitySpec& Spec)
+bool UAuraAbilitySystemComponent::AbilityHasAnySlot(const FGameplayAbilitySpec& Spec) const
 {
-	return Spec.DynamicAbilityTags.HasTag(FGameplayTag::RequestGameplayTag(FName("InputTag")));
+	return GetInputTagFromSpec(Spec).IsValid();
 }
 
 FGameplayAbilitySpec* UAuraAbilitySystemComponent::GetSpecWithSlot(const FGameplayTag& Slot)
 {
-	FScopedAbilityListLock ActiveScopeLock(*this);
+	RebuildAbilitySpecIndexIfDirty();
 
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	if (const TArray<FGameplayAbilitySpecHandle>* Handles = InputTagToSpecHandles.Find(Slot))
 	{
-		if (AbilitySpec.DynamicAbilityTags.HasTagExact(Slot))
-		{
-			return &AbilitySpec;
-		}
+		return GetIndexedSpec((*Handles)[0]);
 	}
 	return nullptr;
 }
 
 FGameplayAbilitySpec* UAuraAbilitySystemComponent::GetSpecFromAbilityTag(const FGameplayTag& AbilityTag)
 {
-	FScopedAbilityListLock ActiveScopeLock(*this);
+	RebuildAbilitySpecIndexIfDirty();
 
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	if (const FGameplayAbilitySpecHandle* Handle = AbilityTagToSpecHandle.Find(AbilityTag))
 	{
-		for (FGameplayTag Tag : AbilitySpec.Ability.Get()->AbilityTags)
-		{
-			if (Tag.MatchesTag(AbilityTag))
-			{
-				return &AbilitySpec;
-			}
-		}
+		return GetIndexedSpec(*Handle);
 	}
 	return nullptr;
 }
@@ -264,6 +255,14 @@ void UAuraAbilitySystemComponent::AssignSlotToAbility(FGameplayAbilitySpec& Spec
 {
 	ClearSlot(&Spec);
 	Spec.DynamicAbilityTags.AddTag(Slot);
+	UpdateAbilitySpecIndex(Spec);
+}
+
+void UAuraAbilitySystemComponent::SetAbilityStatus(FGameplayAbilitySpec& Spec, const FGameplayTag& Status)
+{
+	Spec.DynamicAbilityTags.RemoveTag(FindStatusInSpec(Spec));
+	Spec.DynamicAbilityTags.AddTag(Status);
+	UpdateAbilitySpecIndex(Spec);
 }
 
 void UAuraAbilitySystemComponent::MulticastActivatePassiveEffect_Implementation(
@@ -370,9 +369,7 @@ void UAuraAbilitySystemComponent::ServerEquipAbility_Implementation(const FGamep
 					}
 
 					ClearSlot(SpecWithSlot);
-
-					SpecWithSlot->DynamicAbilityTags.RemoveTag(GameplayTags.Abilities_Status_Equipped);
-					SpecWithSlot->DynamicAbilityTags.AddTag(GameplayTags.Abilities_Status_Unlocked);
+					SetAbilityStatus(*SpecWithSlot, GameplayTags.Abilities_Status_Unlocked);
 
 					MarkAbilitySpecDirty(*SpecWithSlot);
 				}
@@ -393,8 +390,7 @@ void UAuraAbilitySystemComponent::ServerEquipAbility_Implementation(const FGamep
 
 			if (Status.MatchesTagExact(GameplayTags.Abilities_Status_Unlocked))
 			{
-				AbilitySpec->DynamicAbilityTags.RemoveTag(GameplayTags.Abilities_Status_Unlocked);
-				AbilitySpec->DynamicAbilityTags.AddTag(GameplayTags.Abilities_Status_Equipped);
+				SetAbilityStatus(*AbilitySpec, GameplayTags.Abilities_Status_Equipped);
 			}
 
 			MarkAbilitySpecDirty(*AbilitySpec);
@@ -436,20 +432,16 @@ bool UAuraAbilitySystemComponent::GetDescriptionsByAbilityTag(const FGameplayTag
 
 void UAuraAbilitySystemComponent::ClearSlot(FGameplayAbilitySpec* Spec)
 {
-	const FGameplayTag Slot = GetInputTagFromSpec(*Spec);
+	const FGameplayTag Slot = FindInputTagInSpec(*Spec);
 	Spec->DynamicAbilityTags.RemoveTag(Slot);
+	UpdateAbilitySpecIndex(*Spec);
 }
 
 void UAuraAbilitySystemComponent::ClearAbilitiesOfSlot(const FGameplayTag& Slot)
 {
-	FScopedAbilityListLock ActiveScopeLock(*this);
-
-	for (FGameplayAbilitySpec& Spec : GetActivatableAbilities())
+	while (FGameplayAbilitySpec* Spec = GetSpecWithSlot(Slot))
 	{
-		if (AbilityHasSlot(Spec, Slot))
-		{
-			ClearSlot(&Spec);
-		}
+		ClearSlot(Spec);
 	}
 }
 
@@ -475,8 +467,7 @@ void UAuraAbilitySystemComponent::ServerSpendSpellPoint_Implementation(const FGa
 			 * If the status tag is 'Eligible' then after spending a spell point,
 			 * that status should be replaced with 'Unlocked'.
 			 */
-			AbilitySpec->DynamicAbilityTags.RemoveTag(GameplayTags.Abilities_Status_Eligible);
-			AbilitySpec->DynamicAbilityTags.AddTag(GameplayTags.Abilities_Status_Unlocked);
+			SetAbilityStatus(*AbilitySpec, GameplayTags.Abilities_Status_Unlocked);
 			Status = GameplayTags.Abilities_Status_Unlocked;
 		}
 		else if (
@@ -534,6 +525,12 @@ void UAuraAbilitySystemComponent::OnRep_ActivateAbilities()
 {
 	Super::OnRep_ActivateAbilities();
 
+	/**
+	 * Slot and status tags of the replicated specs may have changed without `OnGiveAbility()`/`OnRemoveAbility()`
+	 * being called on the client, so the whole ability spec index has to be rebuilt on next lookup.
+	 */
+	MarkAbilitySpecIndexDirty();
+
 	/**
 	 * Once the abilities are given, then the Ability System Component's (ASC) `ActivatableAbilities` container
 	 * (i.e. returned by `GetActivatableAbilities()` function) replicates as it is a replicated variable.
@@ -556,6 +553,20 @@ void UAuraAbilitySystemComponent::OnRep_ActivateAbilities()
 	}
 }
 
+void UAuraAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+
+	MarkAbilitySpecIndexDirty();
+}
+
+void UAuraAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnRemoveAbility(AbilitySpec);
+
+	MarkAbilitySpecIndexDirty();
+}
+
 void UAuraAbilitySystemComponent::ClientUpdateAbilityStatus_Implementation(
 	const FGameplayTag& AbilityTag,
 	const FGameplayTag& StatusTag,
@@ -574,3 +585,182 @@ void UAuraAbilitySystemComponent::ClientEffectApplied_Implementation(
 
 	EffectAssetTags.Broadcast(TagContainer);
 }
+
+void UAuraAbilitySystemComponent::MarkAbilitySpecIndexDirty()
+{
+	bAbilitySpecIndexDirty = true;
+}
+
+void UAuraAbilitySystemComponent::RebuildAbilitySpecIndexIfDirty()
+{
+	if (!bAbilitySpecIndexDirty) return;
+
+	SpecHandleToIndexEntry.Reset();
+	AbilityTagToSpecHandle.Reset();
+	InputTagToSpecHandles.Reset();
+
+	FScopedAbilityListLock ActiveScopeLock(*this);
+
+	const TArray<FGameplayAbilitySpec>& Specs = GetActivatableAbilities();
+
+	NumSpecsScannedByIndex += Specs.Num();
+	INC_DWORD_STAT_BY(STAT_AuraAbilitySpecIndexSpecsScanned, Specs.Num());
+
+	for (int32 SpecIndex = 0; SpecIndex < Specs.Num(); ++SpecIndex)
+	{
+		const FGameplayAbilitySpec& AbilitySpec = Specs[SpecIndex];
+
+		FAbilitySpecIndexEntry& Entry = SpecHandleToIndexEntry.Add(AbilitySpec.Handle);
+		Entry.AbilityTag = FindAbilityTagInSpec(AbilitySpec);
+		Entry.InputTag = FindInputTagInSpec(AbilitySpec);
+		Entry.StatusTag = FindStatusInSpec(AbilitySpec);
+		Entry.SpecIndex = SpecIndex;
+
+		/**
+		 * Ability tags come from the ability's CDO and never change for a given spec. When more than one spec carries
+		 * the same ability tag, the first one wins just like the linear search used to.
+		 */
+		if (IsValid(AbilitySpec.Ability))
+		{
+			for (const FGameplayTag& Tag : AbilitySpec.Ability.Get()->AbilityTags)
+			{
+				if (!AbilityTagToSpecHandle.Contains(Tag))
+				{
+					AbilityTagToSpecHandle.Add(Tag, AbilitySpec.Handle);
+				}
+			}
+		}
+
+		if (Entry.InputTag.IsValid())
+		{
+			InputTagToSpecHandles.FindOrAdd(Entry.InputTag).Add(AbilitySpec.Handle);
+		}
+	}
+
+	bAbilitySpecIndexDirty = false;
+}
+
+void UAuraAbilitySystemComponent::UpdateAbilitySpecIndex(const FGameplayAbilitySpec& AbilitySpec)
+{
+	// A pending rebuild will pick up the spec's current tags anyway.
+	if (bAbilitySpecIndexDirty) return;
+
+	FAbilitySpecIndexEntry* Entry = SpecHandleToIndexEntry.Find(AbilitySpec.Handle);
+	if (Entry == nullptr)
+	{
+		MarkAbilitySpecIndexDirty();
+		return;
+	}
+
+	if (TArray<FGameplayAbilitySpecHandle>* Handles = InputTagToSpecHandles.Find(Entry->InputTag))
+	{
+		Handles->RemoveSingle(AbilitySpec.Handle);
+		if (Handles->IsEmpty())
+		{
+			InputTagToSpecHandles.Remove(Entry->InputTag);
+		}
+	}
+
+	Entry->InputTag = FindInputTagInSpec(AbilitySpec);
+	Entry->StatusTag = FindStatusInSpec(AbilitySpec);
+
+	if (Entry->InputTag.IsValid())
+	{
+		InputTagToSpecHandles.FindOrAdd(Entry->InputTag).Add(AbilitySpec.Handle);
+	}
+}
+
+void UAuraAbilitySystemComponent::GetSpecHandlesWithInputTag(
+	const FGameplayTag& InputTag,
+	TArray<FGameplayAbilitySpecHandle, TInlineAllocator<4>>& OutHandles)
+{
+	RebuildAbilitySpecIndexIfDirty();
+
+	/**
+	 * The bucket is copied out, since activating an ability can end up re-slotting abilities and mutating the bucket
+	 * we would otherwise be iterating.
+	 */
+	if (const TArray<FGameplayAbilitySpecHandle>* Handles = InputTagToSpecHandles.Find(InputTag))
+	{
+		OutHandles.Append(*Handles);
+	}
+
+	INC_DWORD_STAT(STAT_AuraAbilityInputEvents);
+	INC_DWORD_STAT_BY(STAT_AuraAbilityInputSpecsVisited, OutHandles.Num());
+
+	/** What scanning every activatable spec for the input tag would have visited, for comparison. */
+	INC_DWORD_STAT_BY(STAT_AuraAbilityInputSpecsFullScan, GetActivatableAbilities().Num());
+}
+
+FGameplayAbilitySpec* UAuraAbilitySystemComponent::GetIndexedSpec(const FGameplayAbilitySpecHandle& Handle)
+{
+	if (const FAbilitySpecIndexEntry* Entry = SpecHandleToIndexEntry.Find(Handle))
+	{
+		TArray<FGameplayAbilitySpec>& Specs = GetActivatableAbilities();
+		if (Specs.IsValidIndex(Entry->SpecIndex) && Specs[Entry->SpecIndex].Handle == Handle)
+		{
+			return &Specs[Entry->SpecIndex];
+		}
+	}
+
+	/**
+	 * The activatable abilities were shuffled without us being notified, so take the slow path once and
+	 * rebuild the index on the next lookup.
+	 */
+	MarkAbilitySpecIndexDirty();
+
+	NumSpecsScannedByIndex += GetActivatableAbilities().Num();
+	INC_DWORD_STAT_BY(STAT_AuraAbilitySpecIndexSpecsScanned, GetActivatableAbilities().Num());
+
+	return FindAbilitySpecFromHandle(Handle);
+}
+
+const UAuraAbilitySystemComponent::FAbilitySpecIndexEntry* UAuraAbilitySystemComponent::FindAbilitySpecIndexEntry(
+	const FGameplayAbilitySpec& AbilitySpec) const
+{
+	if (bAbilitySpecIndexDirty) return nullptr;
+
+	return SpecHandleToIndexEntry.Find(AbilitySpec.Handle);
+}
+
+FGameplayTag UAuraAbilitySystemComponent::FindAbilityTagInSpec(const FGameplayAbilitySpec& AbilitySpec)
+{
+	if (IsValid(AbilitySpec.Ability))
+	{
+		const FGameplayTag& AbilitiesRootTag = FAuraGameplayTags::Get().Abilities;
+		for (const FGameplayTag& Tag : AbilitySpec.Ability.Get()->AbilityTags)
+		{
+			if (Tag.MatchesTag(AbilitiesRootTag))
+			{
+				return Tag;
+			}
+		}
+	}
+	return FGameplayTag();
+}
+
+FGameplayTag UAuraAbilitySystemComponent::FindInputTagInSpec(const FGameplayAbilitySpec& AbilitySpec)
+{
+	const FGameplayTag& InputRootTag = FAuraGameplayTags::Get().InputTag;
+	for (const FGameplayTag& Tag : AbilitySpec.DynamicAbilityTags)
+	{
+		if (Tag.MatchesTag(InputRootTag))
+		{
+			return Tag;
+		}
+	}
+	return FGameplayTag();
+}
+
+FGameplayTag UAuraAbilitySystemComponent::FindStatusInSpec(const FGameplayAbilitySpec& AbilitySpec)
+{
+	const FGameplayTag& StatusRootTag = FAuraGameplayTags::Get().Abilities_Status;
+	for (const FGameplayTag& StatusTag : AbilitySpec.DynamicAbilityTags)
+	{
+		if (StatusTag.MatchesTag(StatusRootTag))
+		{
+			return StatusTag;
+		}
+	}
+	return FGameplayTag();
+}
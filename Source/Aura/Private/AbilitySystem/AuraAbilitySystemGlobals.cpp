@@ -4,8 +4,70 @@
 #include "AbilitySystem/AuraAbilitySystemGlobals.h"
 
 #include "AuraAbilityTypes.h"
+#include "AuraGameplayTags.h"
+#include "GameplayEffect.h"
+#include "AbilitySystem/AuraAttributeSet.h"
 
 FGameplayEffectContext* UAuraAbilitySystemGlobals::AllocGameplayEffectContext() const
 {
 	return new FAuraGameplayEffectContext();
 }
+
+UGameplayEffect* UAuraAbilitySystemGlobals::GetDebuffEffect(const FGameplayTag& DamageType, float Frequency)
+{
+	const TPair<FGameplayTag, float> Key(DamageType, Frequency);
+	if (UGameplayEffect* const* Effect = DamageTypeAndFrequencyToDebuffEffect.Find(Key))
+	{
+		return *Effect;
+	}
+
+	UGameplayEffect* Effect = CreateDebuffEffect(DamageType, Frequency);
+	if (Effect)
+	{
+		DebuffEffects.Add(Effect);
+		DamageTypeAndFrequencyToDebuffEffect.Add(Key, Effect);
+	}
+	return Effect;
+}
+
+UGameplayEffect* UAuraAbilitySystemGlobals::CreateDebuffEffect(const FGameplayTag& DamageType, float Frequency)
+{
+	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+
+	const FGameplayTag* DebuffTag = GameplayTags.DamageTypesToDebuffs.Find(DamageType);
+	if (DebuffTag == nullptr) return nullptr;
+
+	const FString DebuffName = FString::Printf(TEXT("DynamicDebuff_%s_%.2f"), *DamageType.ToString(), Frequency);
+	UGameplayEffect* Effect = NewObject<UGameplayEffect>(this, MakeUniqueObjectName(this, UGameplayEffect::StaticClass(), FName(DebuffName)));
+
+	/**
+	 * The duration here is only a placeholder, every spec made from this effect sets its own duration by calling
+	 * `FGameplayEffectSpec::SetDuration()` with the duration locked.
+	 */
+	Effect->DurationPolicy = EGameplayEffectDurationType::HasDuration;
+	Effect->DurationMagnitude = FScalableFloat(1.0f);
+	Effect->Period = Frequency;
+
+	Effect->InheritableOwnedTagsContainer.AddTag(*DebuffTag);
+
+	if (DebuffTag->MatchesTagExact(GameplayTags.Debuff_Stun))
+	{
+		Effect->InheritableOwnedTagsContainer.AddTag(GameplayTags.Player_Block_CursorTrace);
+		Effect->InheritableOwnedTagsContainer.AddTag(GameplayTags.Player_Block_InputHeld);
+		Effect->InheritableOwnedTagsContainer.AddTag(GameplayTags.Player_Block_InputPressed);
+		Effect->InheritableOwnedTagsContainer.AddTag(GameplayTags.Player_Block_InputReleased);
+	}
+
+	Effect->StackingType = EGameplayEffectStackingType::AggregateBySource;
+	Effect->StackLimitCount = 1;
+
+	FSetByCallerFloat SetByCallerDebuffDamage;
+	SetByCallerDebuffDamage.DataTag = GameplayTags.Debuff_Damage;
+
+	FGameplayModifierInfo& ModifierInfo = Effect->Modifiers.AddDefaulted_GetRef();
+	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCallerDebuffDamage);
+	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
+	ModifierInfo.Attribute = UAuraAttributeSet::GetIncomingDamageAttribute();
+
+	return Effect;
+}
@@ -7,7 +7,9 @@
 #include "AbilitySystemComponent.h"
 #include "AuraAbilityTypes.h"
 #include "AuraGameplayTags.h"
+#include "Character/AuraCharacterBase.h"
 #include "GameplayEffectTypes.h"
+#include "Game/AuraCombatantGridSubsystem.h"
 #include "Game/AuraGameModeBase.h"
 #include "Interaction/CombatInterface.h"
 #include "Kismet/GameplayStatics.h"
@@ -313,25 +315,63 @@ void UAuraAbilitySystemLibrary::GetLivePlayersWithinRadius(const UObject* WorldC
 	TArray<AActor*>& OutOverlappingActors, const TArray<AActor*>& ActorsToIgnore, float Radius,
 	const FVector& SphereOrigin)
 {
+	GetLiveHostilesWithinRadius(WorldContextObject, OutOverlappingActors, ActorsToIgnore, Radius, SphereOrigin, nullptr);
+}
+
+void UAuraAbilitySystemLibrary::GetLiveHostilesWithinRadius(const UObject* WorldContextObject,
+	TArray<AActor*>& OutOverlappingActors, const TArray<AActor*>& ActorsToIgnore, float Radius,
+	const FVector& SphereOrigin, AActor* FriendlyToActor)
+{
+	CollectLiveHostilesWithinRadius(WorldContextObject, OutOverlappingActors, nullptr, ActorsToIgnore, Radius, SphereOrigin, FriendlyToActor);
+}
+
+void UAuraAbilitySystemLibrary::GetLiveHostilesWithLocationsWithinRadius(const UObject* WorldContextObject,
+	TArray<AActor*>& OutOverlappingActors, TArray<FVector>& OutLocations, const TArray<AActor*>& ActorsToIgnore,
+	float Radius, const FVector& SphereOrigin, AActor* FriendlyToActor)
+{
+	CollectLiveHostilesWithinRadius(WorldContextObject, OutOverlappingActors, &OutLocations, ActorsToIgnore, Radius, SphereOrigin, FriendlyToActor);
+}
+
+void UAuraAbilitySystemLibrary::CollectLiveHostilesWithinRadius(const UObject* WorldContextObject,
+	TArray<AActor*>& OutOverlappingActors, TArray<FVector>* OutLocations, const TArray<AActor*>& ActorsToIgnore,
+	float Radius, const FVector& SphereOrigin, AActor* FriendlyToActor)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (World == nullptr) return;
+
+	/**
+	 * The combatant grid only contains the live `ICombatInterface` actors, so the query there doesn't need any of
+	 * the checks below. The physics overlap is only kept for worlds without the subsystem.
+	 */
+	if (const UAuraCombatantGridSubsystem* CombatantGrid = World->GetSubsystem<UAuraCombatantGridSubsystem>())
+	{
+		CombatantGrid->GetLiveCombatantsWithinRadius(OutOverlappingActors, ActorsToIgnore, Radius, SphereOrigin, FriendlyToActor, OutLocations);
+		return;
+	}
+
 	FCollisionQueryParams SphereParams;
 	SphereParams.AddIgnoredActors(ActorsToIgnore);
 
 	TArray<FOverlapResult> Overlaps;
-	if (const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	World->OverlapMultiByObjectType(Overlaps, SphereOrigin, FQuat::Identity, FCollisionObjectQueryParams(FCollisionObjectQueryParams::InitType::AllDynamicObjects), FCollisionShape::MakeSphere(Radius), SphereParams);
+	for (FOverlapResult& Overlap : Overlaps)
 	{
-		World->OverlapMultiByObjectType(Overlaps, SphereOrigin, FQuat::Identity, FCollisionObjectQueryParams(FCollisionObjectQueryParams::InitType::AllDynamicObjects), FCollisionShape::MakeSphere(Radius), SphereParams);
-		for (FOverlapResult& Overlap : Overlaps)
+		/**
+		 * Add the overlapped actor to the `OutOverlappingActors` array if,
+		 * [1] it implements `UCombatInterface` (unlike using `ICombatInterface` with `Cast<T>()` template function,
+		 * the `Implements<T>()` template function expects the type derived from `UInterface` class) AND
+		 * [2] it is not dead AND
+		 * [3] it is not a friend of `FriendlyToActor`, if that is given.
+		 */
+		if (Overlap.GetActor()->Implements<UCombatInterface>() && !ICombatInterface::Execute_IsDead(Overlap.GetActor()))
 		{
-			/**
-			 * Add the overlapped actor to the `OutOverlappingActors` array if,
-			 * [1] it implements `UCombatInterface` (unlike using `ICombatInterface` with `Cast<T>()` template function,
-			 * the `Implements<T>()` template function expects the type derived from `UInterface` class) AND
-			 * [2] it is not dead.
-			 */
-			if (Overlap.GetActor()->Implements<UCombatInterface>() && !ICombatInterface::Execute_IsDead(Overlap.GetActor()))
-			{
-				OutOverlappingActors.AddUnique(ICombatInterface::Execute_GetAvatar(Overlap.GetActor()));
-			}
+			AActor* Avatar = ICombatInterface::Execute_GetAvatar(Overlap.GetActor());
+			if (IsValid(FriendlyToActor) && !IsNotFriend(FriendlyToActor, Avatar)) continue;
+
+			if (OutOverlappingActors.Contains(Avatar)) continue;
+
+			OutOverlappingActors.Add(Avatar);
+			if (OutLocations) OutLocations->Add(Avatar->GetActorLocation());
 		}
 	}
 }
@@ -346,55 +386,152 @@ void UAuraAbilitySystemLibrary::GetClosestTargets(int32 MaxTargets, const TArray
 		return;
 	}
 
-	TArray<AActor*> ActorsToCheck = Actors;
-	int32 NumTargetsFound = 0;
+	SelectClosestTargets(MaxTargets, Actors, TArrayView<const FVector>(), OutClosestTargets, Origin);
+}
+
+void UAuraAbilitySystemLibrary::SelectClosestTargets(int32 MaxTargets, TArrayView<AActor* const> Actors,
+	TArrayView<const FVector> ActorLocations, TArray<AActor*>& OutClosestTargets, const FVector& Origin)
+{
+	if (MaxTargets <= 0 || Actors.Num() == 0) return;
+
+	const bool bHasLocations = ActorLocations.Num() == Actors.Num();
+
+	struct FCandidate
+	{
+		double DistanceSquared;
+		int32 Index;
+	};
+
+	/** Keeps the farthest of the current closest candidates on top of the heap, so it's the one to be replaced. */
+	const auto FartherFirst = [](const FCandidate& A, const FCandidate& B) { return A.DistanceSquared > B.DistanceSquared; };
+
+	TArray<FCandidate, TInlineAllocator<32>> Heap;
+	Heap.Reserve(FMath::Min(MaxTargets, Actors.Num()));
 
-	while (NumTargetsFound < MaxTargets)
+	for (int32 Index = 0; Index < Actors.Num(); ++Index)
 	{
-		if (ActorsToCheck.Num() == 0) break;
+		if (!IsValid(Actors[Index])) continue;
 
-		double ClosestDistance = TNumericLimits<double>::Max();
-		AActor* ClosestActor = nullptr;
+		// The squared distance between the `PotentialTarget` and `Origin`, enough for comparison & no square root needed.
+		const FVector& Location = bHasLocations ? ActorLocations[Index] : Actors[Index]->GetActorLocation();
+		const double DistanceSquared = FVector::DistSquared(Location, Origin);
 
-		for (AActor* PotentialTarget : ActorsToCheck)
+		if (Heap.Num() < MaxTargets)
 		{
-			// The distance between the `PotentialTarget` and `Origin`. This is from `Origin` to each `PotentialTarget`.
-			const double Distance = (PotentialTarget->GetActorLocation() - Origin).Length();
-			if (Distance < ClosestDistance)
-			{
-				ClosestDistance = Distance;
-				ClosestActor = PotentialTarget;
-			}
+			Heap.HeapPush({DistanceSquared, Index}, FartherFirst);
+		}
+		else if (DistanceSquared < Heap.HeapTop().DistanceSquared)
+		{
+			Heap.HeapPopDiscard(FartherFirst, false);
+			Heap.HeapPush({DistanceSquared, Index}, FartherFirst);
 		}
-		ActorsToCheck.Remove(ClosestActor);
-		OutClosestTargets.AddUnique(ClosestActor);
-		++NumTargetsFound;
+	}
+
+	/** Same order as before, the closest target first. */
+	Heap.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistanceSquared < B.DistanceSquared; });
+
+	OutClosestTargets.Reserve(OutClosestTargets.Num() + Heap.Num());
+	for (const FCandidate& Candidate : Heap)
+	{
+		OutClosestTargets.AddUnique(Actors[Candidate.Index]);
 	}
 }
 
 bool UAuraAbilitySystemLibrary::IsNotFriend(AActor* FirstActor, AActor* SecondActor)
 {
-	const bool bBothAreFriends = FirstActor->ActorHasTag("Player") && SecondActor->ActorHasTag("Player");
-	const bool bBothAreEnemies = FirstActor->ActorHasTag("Enemy") && SecondActor->ActorHasTag("Enemy");
-	const bool bFriends = bBothAreFriends || bBothAreEnemies;
-	return !bFriends;
+	return !AuraTeam::AreFriends(GetActorTeam(FirstActor), GetActorTeam(SecondActor));
+}
+
+EAuraTeam UAuraAbilitySystemLibrary::GetActorTeam(const AActor* Actor)
+{
+	if (Actor == nullptr) return EAuraTeam::None;
+
+	/** Fast path for the characters, `Cast<T>()` to a class is cheaper than looking up the interface. */
+	if (const AAuraCharacterBase* Character = Cast<AAuraCharacterBase>(Actor))
+	{
+		return Character->GetTeam();
+	}
+	if (const ICombatInterface* CombatInterface = Cast<ICombatInterface>(Actor))
+	{
+		return CombatInterface->GetTeam();
+	}
+
+	if (Actor->ActorHasTag(FName("Player"))) return EAuraTeam::Player;
+	if (Actor->ActorHasTag(FName("Enemy"))) return EAuraTeam::Enemy;
+	return EAuraTeam::None;
 }
 
 FGameplayEffectContextHandle UAuraAbilitySystemLibrary::ApplyDamageEffect(const FDamageEffectParams& DamageEffectParams)
+{
+	FGameplayEffectContextHandle EffectContextHandle;
+	const FGameplayEffectSpecHandle SpecHandle = MakeDamageEffectSpec(DamageEffectParams, EffectContextHandle);
+
+	DamageEffectParams.TargetAbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data); // Calling `*SpecHandle.Data` is same as `*SpecHandle.Data.Get()`
+
+	return EffectContextHandle;
+}
+
+void UAuraAbilitySystemLibrary::ApplyDamageEffectToTargets(const FDamageEffectParams& DamageEffectParams,
+	TArrayView<UAbilitySystemComponent* const> TargetAbilitySystemComponents)
+{
+	if (TargetAbilitySystemComponents.Num() == 0) return;
+
+	FGameplayEffectContextHandle TemplateContextHandle;
+	const FGameplayEffectSpecHandle TemplateSpecHandle = MakeDamageEffectSpec(DamageEffectParams, TemplateContextHandle);
+	if (!TemplateSpecHandle.IsValid()) return;
+
+	const AActor* SourceAvatarActor = DamageEffectParams.SourceAbilitySystemComponent->GetAvatarActor();
+
+	for (UAbilitySystemComponent* TargetASC : TargetAbilitySystemComponents)
+	{
+		if (!IsValid(TargetASC)) continue;
+
+		/**
+		 * Every target gets its own copy of the spec and of the effect context, since `UExecCalc_Damage` writes the
+		 * blocked/critical hit and debuff results of that particular target into the context.
+		 */
+		FGameplayEffectSpec TargetSpec(*TemplateSpecHandle.Data);
+		TargetSpec.DuplicateEffectContext();
+		FGameplayEffectContextHandle TargetContextHandle = TargetSpec.GetContext();
+
+		const AActor* TargetAvatarActor = TargetASC->GetAvatarActor();
+		if (IsValid(SourceAvatarActor) && IsValid(TargetAvatarActor))
+		{
+			FRotator Rotation = (TargetAvatarActor->GetActorLocation() - SourceAvatarActor->GetActorLocation()).Rotation();
+			Rotation.Pitch = 45.0f;
+			const FVector ToTarget = Rotation.Vector();
+
+			if (DamageEffectParams.DeathImpulseMagnitude > 0.0f)
+			{
+				SetDeathImpulse(TargetContextHandle, ToTarget * DamageEffectParams.DeathImpulseMagnitude);
+			}
+			if (DamageEffectParams.KnockbackForceMagnitude > 0.0f)
+			{
+				const bool bKnockback = FMath::RandRange(1, 100) < DamageEffectParams.KnockbackChance;
+				SetKnockbackForce(TargetContextHandle, bKnockback ? ToTarget * DamageEffectParams.KnockbackForceMagnitude : FVector::ZeroVector);
+			}
+		}
+
+		TargetASC->ApplyGameplayEffectSpecToSelf(TargetSpec);
+	}
+}
+
+FGameplayEffectSpecHandle UAuraAbilitySystemLibrary::MakeDamageEffectSpec(const FDamageEffectParams& DamageEffectParams,
+	FGameplayEffectContextHandle& OutEffectContextHandle)
 {
 	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
 	const AActor* SourceAvatarActor = DamageEffectParams.SourceAbilitySystemComponent->GetAvatarActor();
 
-	FGameplayEffectContextHandle EffectContextHandle = DamageEffectParams.SourceAbilitySystemComponent->MakeEffectContext();
-	EffectContextHandle.AddSourceObject(SourceAvatarActor);
+	OutEffectContextHandle = DamageEffectParams.SourceAbilitySystemComponent->MakeEffectContext();
+	OutEffectContextHandle.AddSourceObject(SourceAvatarActor);
 
-	SetDeathImpulse(EffectContextHandle, DamageEffectParams.DeathImpulse);
-	SetKnockbackForce(EffectContextHandle, DamageEffectParams.KnockbackForce);
+	SetDeathImpulse(OutEffectContextHandle, DamageEffectParams.DeathImpulse);
+	SetKnockbackForce(OutEffectContextHandle, DamageEffectParams.KnockbackForce);
 
 	const FGameplayEffectSpecHandle SpecHandle = DamageEffectParams.SourceAbilitySystemComponent->MakeOutgoingSpec(
 		DamageEffectParams.DamageGameplayEffectClass,
 		DamageEffectParams.AbilityLevel,
-		EffectContextHandle
+		OutEffectContextHandle
 	);
 
 	UAbilitySystemBlueprintLibrary::AssignTagSetByCallerMagnitude(SpecHandle, DamageEffectParams.DamageType, DamageEffectParams.BaseDamage);
@@ -403,9 +540,7 @@ FGameplayEffectContextHandle UAuraAbilitySystemLibrary::ApplyDamageEffect(const
 	UAbilitySystemBlueprintLibrary::AssignTagSetByCallerMagnitude(SpecHandle, GameplayTags.Debuff_Duration, DamageEffectParams.DebuffDuration);
 	UAbilitySystemBlueprintLibrary::AssignTagSetByCallerMagnitude(SpecHandle, GameplayTags.Debuff_Frequency, DamageEffectParams.DebuffFrequency);
 
-	DamageEffectParams.TargetAbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data); // Calling `*SpecHandle.Data` is same as `*SpecHandle.Data.Get()`
-
-	return EffectContextHandle;
+	return SpecHandle;
 }
 
 TArray<FRotator> UAuraAbilitySystemLibrary::EvenlySpacedRotators(const FVector& Forward, const FVector& Axis, float Spread, int32 NumRotators)
@@ -7,13 +7,57 @@
 #include "AuraAbilityTypes.h"
 #include "GameFramework/Character.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "GameplayEffectExtension.h"
 #include "AuraGameplayTags.h"
+#include "AbilitySystem/AuraAbilitySystemGlobals.h"
 #include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "Game/AuraDamageNumberSubsystem.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Interaction/CombatInterface.h"
 #include "Interaction/PlayerInterface.h"
-#include "Player/AuraPlayerController.h"
+
+bool FAuraQuantizedAttributeData::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 bCurrentMatchesBase = Ar.IsSaving() && CurrentValue == BaseValue;
+	Ar.SerializeBits(&bCurrentMatchesBase, 1);
+
+	SerializeQuantizedValue(Ar, BaseValue);
+
+	if (bCurrentMatchesBase)
+	{
+		CurrentValue = BaseValue;
+	}
+	else
+	{
+		SerializeQuantizedValue(Ar, CurrentValue);
+	}
+
+	bOutSuccess = true;
+	return true;
+}
+
+void FAuraQuantizedAttributeData::SerializeQuantizedValue(FArchive& Ar, float& Value) const
+{
+	const float Range = QuantizeMax - QuantizeMin;
+
+	uint8 bQuantized = Ar.IsSaving() && Range > 0.0f && Range <= MaxQuantizeRange && Value >= QuantizeMin && Value <= QuantizeMax;
+	Ar.SerializeBits(&bQuantized, 1);
+
+	if (!bQuantized)
+	{
+		Ar << Value;
+		return;
+	}
+
+	uint32 QuantizedValue = Ar.IsSaving() ? static_cast<uint32>(FMath::RoundToInt64((Value - QuantizeMin) * StepsPerUnit)) : 0;
+	Ar.SerializeIntPacked(QuantizedValue);
+
+	if (Ar.IsLoading())
+	{
+		Value = QuantizeMin + QuantizedValue / StepsPerUnit;
+	}
+}
 
 UAuraAttributeSet::UAuraAttributeSet()
 {
@@ -51,37 +95,53 @@ void UAuraAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
+	/**
+	 * All the attributes are push based, they are only compared by the net driver after `MarkAttributeDirty()`
+	 * flagged them from `PostAttributeBaseChange()` or `PostAttributeChange()`. Targets built without `WITH_PUSH_MODEL`
+	 * (e.g. the Game target on a launcher engine) ignore the flag & compare them every net update as usual.
+	 */
+	FDoRepLifetimeParams SharedParams;
+	SharedParams.bIsPushBased = true;
+	SharedParams.RepNotifyCondition = REPNOTIFY_Always;
+
+	/**
+	 * Everything but Health & MaxHealth (the health bars) is only read by the owning player,
+	 * for the attribute menu, the overlay & predicting the ability costs.
+	 */
+	FDoRepLifetimeParams OwnerOnlyParams = SharedParams;
+	OwnerOnlyParams.Condition = COND_OwnerOnly;
+
 	// Primary Attributes.
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Strength, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Intelligence, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Resilience, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Vigor, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Strength, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Intelligence, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Resilience, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Vigor, OwnerOnlyParams);
 
 	// Secondary Attributes.
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Armor, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, ArmorPenetration, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, BlockChance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, CriticalHitChance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, CriticalHitDamage, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, CriticalHitResistance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, HealthRegeneration, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, ManaRegeneration, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, MaxHealth, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, MaxMana, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Armor, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, ArmorPenetration, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, BlockChance, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, CriticalHitChance, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, CriticalHitDamage, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, CriticalHitResistance, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, HealthRegeneration, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, ManaRegeneration, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, MaxHealth, SharedParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, MaxMana, OwnerOnlyParams);
 
 	// Resistance Attributes.
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, FireResistance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, LightningResistance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, ArcaneResistance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, PhysicalResistance, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, FireResistance, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, LightningResistance, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, ArcaneResistance, OwnerOnlyParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, PhysicalResistance, OwnerOnlyParams);
 
 	// Vital Attributes.
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Health, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Mana, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Health, SharedParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Mana, OwnerOnlyParams);
 }
 
 void UAuraAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
@@ -98,10 +158,25 @@ void UAuraAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute,
 	}
 }
 
+void UAuraAttributeSet::PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const
+{
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+
+	if (OldValue != NewValue)
+	{
+		MarkAttributeDirty(Attribute);
+	}
+}
+
 void UAuraAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue)
 {
 	Super::PostAttributeChange(Attribute, OldValue, NewValue);
 
+	if (OldValue != NewValue)
+	{
+		MarkAttributeDirty(Attribute);
+	}
+
 	if (Attribute == GetMaxHealthAttribute() && bTopOffHealth)
 	{
 		SetHealth(GetMaxHealth());
@@ -142,6 +217,15 @@ void UAuraAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallba
 	}
 }
 
+void UAuraAttributeSet::MarkAttributeDirty(const FGameplayAttribute& Attribute) const
+{
+	/** Meta attributes aren't replicated, so they don't have a replication index to mark. */
+	const FProperty* Property = Attribute.GetUProperty();
+	if (Property == nullptr || !Property->HasAnyPropertyFlags(CPF_Net)) return;
+
+	MARK_PROPERTY_DIRTY(this, Property);
+}
+
 void UAuraAttributeSet::OnRep_Strength(const FGameplayAttributeData& OldStrength) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, Strength, OldStrength);
@@ -162,7 +246,7 @@ void UAuraAttributeSet::OnRep_Vigor(const FGameplayAttributeData& OldVigor) cons
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, Vigor, OldVigor);
 }
 
-void UAuraAttributeSet::OnRep_Health(const FGameplayAttributeData& OldHealth) const
+void UAuraAttributeSet::OnRep_Health(const FAuraQuantizedAttributeData& OldHealth) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, Health, OldHealth);
 }
@@ -172,47 +256,47 @@ void UAuraAttributeSet::OnRep_Mana(const FGameplayAttributeData& OldMana) const
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, Mana, OldMana);
 }
 
-void UAuraAttributeSet::OnRep_Armor(const FGameplayAttributeData& OldArmor) const
+void UAuraAttributeSet::OnRep_Armor(const FAuraQuantizedAttributeData& OldArmor) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, Armor, OldArmor);
 }
 
-void UAuraAttributeSet::OnRep_ArmorPenetration(const FGameplayAttributeData& OldArmorPenetration) const
+void UAuraAttributeSet::OnRep_ArmorPenetration(const FAuraQuantizedAttributeData& OldArmorPenetration) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, ArmorPenetration, OldArmorPenetration);
 }
 
-void UAuraAttributeSet::OnRep_BlockChance(const FGameplayAttributeData& OldBlockChance) const
+void UAuraAttributeSet::OnRep_BlockChance(const FAuraQuantizedAttributeData& OldBlockChance) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, BlockChance, OldBlockChance);
 }
 
-void UAuraAttributeSet::OnRep_CriticalHitChance(const FGameplayAttributeData& OldCriticalHitChance) const
+void UAuraAttributeSet::OnRep_CriticalHitChance(const FAuraQuantizedAttributeData& OldCriticalHitChance) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, CriticalHitChance, OldCriticalHitChance);
 }
 
-void UAuraAttributeSet::OnRep_CriticalHitDamage(const FGameplayAttributeData& OldCriticalHitDamage) const
+void UAuraAttributeSet::OnRep_CriticalHitDamage(const FAuraQuantizedAttributeData& OldCriticalHitDamage) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, CriticalHitDamage, OldCriticalHitDamage);
 }
 
-void UAuraAttributeSet::OnRep_CriticalHitResistance(const FGameplayAttributeData& OldCriticalHitResistance) const
+void UAuraAttributeSet::OnRep_CriticalHitResistance(const FAuraQuantizedAttributeData& OldCriticalHitResistance) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, CriticalHitResistance, OldCriticalHitResistance);
 }
 
-void UAuraAttributeSet::OnRep_HealthRegeneration(const FGameplayAttributeData& OldHealthRegeneration) const
+void UAuraAttributeSet::OnRep_HealthRegeneration(const FAuraQuantizedAttributeData& OldHealthRegeneration) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, HealthRegeneration, OldHealthRegeneration);
 }
 
-void UAuraAttributeSet::OnRep_ManaRegeneration(const FGameplayAttributeData& OldManaRegeneration) const
+void UAuraAttributeSet::OnRep_ManaRegeneration(const FAuraQuantizedAttributeData& OldManaRegeneration) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, ManaRegeneration, OldManaRegeneration);
 }
 
-void UAuraAttributeSet::OnRep_MaxHealth(const FGameplayAttributeData& OldMaxHealth) const
+void UAuraAttributeSet::OnRep_MaxHealth(const FAuraQuantizedAttributeData& OldMaxHealth) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, MaxHealth, OldMaxHealth);
 }
@@ -222,22 +306,22 @@ void UAuraAttributeSet::OnRep_MaxMana(const FGameplayAttributeData& OldMaxMana)
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, MaxMana, OldMaxMana);
 }
 
-void UAuraAttributeSet::OnRep_FireResistance(const FGameplayAttributeData& OldFireResistance) const
+void UAuraAttributeSet::OnRep_FireResistance(const FAuraQuantizedAttributeData& OldFireResistance) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, FireResistance, OldFireResistance);
 }
 
-void UAuraAttributeSet::OnRep_LightningResistance(const FGameplayAttributeData& OldLightningResistance) const
+void UAuraAttributeSet::OnRep_LightningResistance(const FAuraQuantizedAttributeData& OldLightningResistance) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, LightningResistance, OldLightningResistance);
 }
 
-void UAuraAttributeSet::OnRep_ArcaneResistance(const FGameplayAttributeData& OldArcaneResistance) const
+void UAuraAttributeSet::OnRep_ArcaneResistance(const FAuraQuantizedAttributeData& OldArcaneResistance) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, ArcaneResistance, OldArcaneResistance);
 }
 
-void UAuraAttributeSet::OnRep_PhysicalResistance(const FGameplayAttributeData& OldPhysicalResistance) const
+void UAuraAttributeSet::OnRep_PhysicalResistance(const FAuraQuantizedAttributeData& OldPhysicalResistance) const
 {
 	GAMEPLAYATTRIBUTE_REPNOTIFY(UAuraAttributeSet, PhysicalResistance, OldPhysicalResistance);
 }
@@ -358,52 +442,28 @@ void UAuraAttributeSet::Debuff(const FEffectProperties& Props)
 	const float DebuffDuration = UAuraAbilitySystemLibrary::GetDebuffDuration(Props.EffectContextHandle);
 	const float DebuffFrequency = UAuraAbilitySystemLibrary::GetDebuffFrequency(Props.EffectContextHandle);
 
-	const FString DebuffName = FString::Printf(TEXT("DynamicDebuff_%s"), *DamageType.ToString());
-	UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), FName(DebuffName));
-
-	Effect->DurationPolicy = EGameplayEffectDurationType::HasDuration;
-	Effect->Period = DebuffFrequency;
-	Effect->DurationMagnitude = FScalableFloat(DebuffDuration);
+	UAuraAbilitySystemGlobals& AbilitySystemGlobals = static_cast<UAuraAbilitySystemGlobals&>(UAbilitySystemGlobals::Get());
+	UGameplayEffect* Effect = AbilitySystemGlobals.GetDebuffEffect(DamageType, DebuffFrequency);
+	if (Effect == nullptr) return;
 
-	const FGameplayTag DebuffTag = GameplayTags.DamageTypesToDebuffs[DamageType];
-	Effect->InheritableOwnedTagsContainer.AddTag(DebuffTag);
+	FGameplayEffectSpec DebuffSpec(Effect, EffectContext, 1.0f);
+	DebuffSpec.SetSetByCallerMagnitude(GameplayTags.Debuff_Damage, DebuffDamage);
+	DebuffSpec.SetDuration(DebuffDuration, true);
 
-	if (DebuffTag.MatchesTagExact(GameplayTags.Debuff_Stun))
-	{
-		Effect->InheritableOwnedTagsContainer.AddTag(GameplayTags.Player_Block_CursorTrace);
-		Effect->InheritableOwnedTagsContainer.AddTag(GameplayTags.Player_Block_InputHeld);
-		Effect->InheritableOwnedTagsContainer.AddTag(GameplayTags.Player_Block_InputPressed);
-		Effect->InheritableOwnedTagsContainer.AddTag(GameplayTags.Player_Block_InputReleased);
-	}
+	FAuraGameplayEffectContext* AuraContext = static_cast<FAuraGameplayEffectContext*>(
+		DebuffSpec.GetContext().Get() // Or use `EffectContext.Get()`
+	);
 
-	Effect->StackingType = EGameplayEffectStackingType::AggregateBySource;
-	Effect->StackLimitCount = 1;
+	TSharedPtr<FGameplayTag> DebuffDamageType = MakeShareable(new FGameplayTag(DamageType));
+	/** Alternatively, we may write the same line as follows,
+	 * DebuffDamageType = MakeShared<FGameplayTag>(DamageType);
+	 *
+	 * Reference: https://dev.epicgames.com/documentation/en-us/unreal-engine/smart-pointers-in-unreal-engine
+	 */
 
-	const int32 Index = Effect->Modifiers.Num();
-	Effect->Modifiers.Add(FGameplayModifierInfo());
-	FGameplayModifierInfo& ModifierInfo = Effect->Modifiers[Index];
+	AuraContext->SetDamageType(DebuffDamageType);
 
-	ModifierInfo.ModifierMagnitude = FScalableFloat(DebuffDamage);
-	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
-	ModifierInfo.Attribute = UAuraAttributeSet::GetIncomingDamageAttribute();
-
-	if (FGameplayEffectSpec* MutableSpec = new FGameplayEffectSpec(Effect, EffectContext, 1.0f))
-	{
-		FAuraGameplayEffectContext* AuraContext = static_cast<FAuraGameplayEffectContext*>(
-			MutableSpec->GetContext().Get() // Or use `EffectContext.Get()`
-		);
-
-		TSharedPtr<FGameplayTag> DebuffDamageType = MakeShareable(new FGameplayTag(DamageType));
-		/** Alternatively, we may write the same line as follows,
-		 * DebuffDamageType = MakeShared<FGameplayTag>(DamageType);
-		 *
-		 * Reference: https://dev.epicgames.com/documentation/en-us/unreal-engine/smart-pointers-in-unreal-engine
-		 */
-
-		AuraContext->SetDamageType(DebuffDamageType);
-
-		Props.TargetASC->ApplyGameplayEffectSpecToSelf(*MutableSpec);
-	}
+	Props.TargetASC->ApplyGameplayEffectSpecToSelf(DebuffSpec);
 }
 
 void UAuraAttributeSet::SetEffectProperties(const FGameplayEffectModCallbackData& Data, FEffectProperties& Props) const
@@ -449,13 +509,13 @@ void UAuraAttributeSet::ShowFloatingText(const FEffectProperties& Props, float D
 {
 	if (Props.SourceCharacter != Props.TargetCharacter)
 	{
-		// Show the damage number and text on each client.
-		for (FConstPlayerControllerIterator PlayerControllerIterator = GetWorld()->GetPlayerControllerIterator(); PlayerControllerIterator; ++PlayerControllerIterator)
+		/**
+		 * Hits are coalesced per target and sent to each client once at the end of the frame,
+		 * instead of sending a client RPC to every player controller for every hit.
+		 */
+		if (UAuraDamageNumberSubsystem* DamageNumberSubsystem = GetWorld()->GetSubsystem<UAuraDamageNumberSubsystem>())
 		{
-			if (AAuraPlayerController* AuraPlayerController = Cast<AAuraPlayerController>(PlayerControllerIterator->Get()))
-			{
-				AuraPlayerController->ShowDamageNumber(Damage, Props.TargetCharacter, bBlockedHit, bCriticalHit);
-			}
+			DamageNumberSubsystem->AddDamageNumber(Props.TargetCharacter, Damage, bBlockedHit, bCriticalHit);
 		}
 	}
 }
@@ -3,7 +3,90 @@
 
 #include "AbilitySystem/Data/CharacterClassInfo.h"
 
+#include "Engine/CurveTable.h"
+
 FCharacterClassDefaultInfo UCharacterClassInfo::GetClassDefaultInfo(ECharacterClass CharacterClass)
 {
 	return CharacterClassInformation.FindChecked(CharacterClass);
 }
+
+FDamageCalculationCoefficients UCharacterClassInfo::GetDamageCalculationCoefficients(int32 Level)
+{
+	if (!bDamageCalculationCoefficientsBaked)
+	{
+		BakeDamageCalculationCoefficients();
+	}
+
+	if (BakedDamageCalculationCoefficients.IsValidIndex(Level))
+	{
+		return BakedDamageCalculationCoefficients[Level];
+	}
+
+	FDamageCalculationCoefficients Coefficients;
+	Coefficients.ArmorPenetration = ArmorPenetrationCurve ? ArmorPenetrationCurve->Eval(Level) : 0.0f;
+	Coefficients.EffectiveArmor = EffectiveArmorCurve ? EffectiveArmorCurve->Eval(Level) : 0.0f;
+	Coefficients.CriticalHitResistance = CriticalHitResistanceCurve ? CriticalHitResistanceCurve->Eval(Level) : 0.0f;
+	return Coefficients;
+}
+
+#if WITH_EDITOR
+void UCharacterClassInfo::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	InvalidateDamageCalculationCoefficients();
+}
+#endif
+
+void UCharacterClassInfo::BakeDamageCalculationCoefficients()
+{
+	BakedDamageCalculationCoefficients.Reset();
+	bDamageCalculationCoefficientsBaked = true;
+
+	if (DamageCalculationCoefficients == nullptr) return;
+
+#if WITH_EDITOR
+	// Re-bake whenever the curve table is edited or re-imported, the curve pointers are invalidated by that as well.
+	if (!DamageCalculationCoefficients->OnCurveTableChanged().IsBoundToObject(this))
+	{
+		DamageCalculationCoefficients->OnCurveTableChanged().AddUObject(this, &UCharacterClassInfo::InvalidateDamageCalculationCoefficients);
+	}
+#endif
+
+	ArmorPenetrationCurve = DamageCalculationCoefficients->FindCurve(FName("ArmorPenetration"), FString());
+	EffectiveArmorCurve = DamageCalculationCoefficients->FindCurve(FName("EffectiveArmor"), FString());
+	CriticalHitResistanceCurve = DamageCalculationCoefficients->FindCurve(FName("CriticalHitResistance"), FString());
+
+	float MaxLevel = 0.0f;
+	for (const FRealCurve* Curve : { ArmorPenetrationCurve, EffectiveArmorCurve, CriticalHitResistanceCurve })
+	{
+		if (Curve)
+		{
+			float MinTime = 0.0f;
+			float MaxTime = 0.0f;
+			Curve->GetTimeRange(MinTime, MaxTime);
+			MaxLevel = FMath::Max(MaxLevel, MaxTime);
+		}
+	}
+
+	const int32 NumLevels = FMath::CeilToInt32(MaxLevel) + 1;
+	BakedDamageCalculationCoefficients.SetNum(NumLevels);
+
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		FDamageCalculationCoefficients& Coefficients = BakedDamageCalculationCoefficients[Level];
+		Coefficients.ArmorPenetration = ArmorPenetrationCurve ? ArmorPenetrationCurve->Eval(Level) : 0.0f;
+		Coefficients.EffectiveArmor = EffectiveArmorCurve ? EffectiveArmorCurve->Eval(Level) : 0.0f;
+		Coefficients.CriticalHitResistance = CriticalHitResistanceCurve ? CriticalHitResistanceCurve->Eval(Level) : 0.0f;
+	}
+}
+
+void UCharacterClassInfo::InvalidateDamageCalculationCoefficients()
+{
+	ArmorPenetrationCurve = nullptr;
+	EffectiveArmorCurve = nullptr;
+	CriticalHitResistanceCurve = nullptr;
+
+	BakedDamageCalculationCoefficients.Reset();
+	bDamageCalculationCoefficientsBaked = false;
+}
@@ -48,6 +48,49 @@ static const AuraDamageStatics& DamageStatics()
 	return DStatics;
 }
 
+/** A damage type & the resistance attribute of the target to capture for it. */
+struct FAuraDamageTypeCapture
+{
+	FGameplayTag DamageType;
+	FGameplayEffectAttributeCaptureDefinition ResistanceDef;
+};
+
+/**
+ * Immutable table of all the damage types, built once from `FAuraGameplayTags::DamageTypesToResistances`
+ * & the resistance capture definitions of `DamageStatics()`.
+ *
+ * This can't live inside `AuraDamageStatics` itself, because that one is first constructed along with the CDO of
+ * `UExecCalc_Damage`, which happens before the native Gameplay Tags are initialized.
+ */
+static const TArray<FAuraDamageTypeCapture>& DamageTypeCaptures()
+{
+	static const TArray<FAuraDamageTypeCapture> Captures = []()
+	{
+		const FAuraGameplayTags& Tags = FAuraGameplayTags::Get();
+		const AuraDamageStatics& Statics = DamageStatics();
+
+		const TMap<FGameplayTag, FGameplayEffectAttributeCaptureDefinition> ResistanceTagsToDefs =
+		{
+			{ Tags.Attributes_Resistance_Fire, Statics.FireResistanceDef },
+			{ Tags.Attributes_Resistance_Lightning, Statics.LightningResistanceDef },
+			{ Tags.Attributes_Resistance_Arcane, Statics.ArcaneResistanceDef },
+			{ Tags.Attributes_Resistance_Physical, Statics.PhysicalResistanceDef }
+		};
+
+		TArray<FAuraDamageTypeCapture> Result;
+		Result.Reserve(Tags.DamageTypesToResistances.Num());
+		for (const TPair<FGameplayTag, FGameplayTag>& Pair : Tags.DamageTypesToResistances)
+		{
+			const FGameplayEffectAttributeCaptureDefinition* ResistanceDef = ResistanceTagsToDefs.Find(Pair.Value);
+			checkf(ResistanceDef, TEXT("No resistance capture definition for [%s] in ExecCalc_Damage"), *Pair.Value.ToString());
+
+			Result.Add({ Pair.Key, *ResistanceDef });
+		}
+		return Result;
+	}();
+	return Captures;
+}
+
 UExecCalc_Damage::UExecCalc_Damage()
 {
 	RelevantAttributesToCapture.Add(DamageStatics().ArmorDef);
@@ -65,14 +108,12 @@ UExecCalc_Damage::UExecCalc_Damage()
 
 void UExecCalc_Damage::DetermineDebuff(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
 	const FGameplayEffectSpec& Spec,
-	FAggregatorEvaluateParameters EvaluationParameters,
-	const TMap<FGameplayTag, FGameplayEffectAttributeCaptureDefinition>& InTagsToDefs) const
+	const FAggregatorEvaluateParameters& EvaluationParameters) const
 {
 	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
-	for (TTuple<FGameplayTag, FGameplayTag> Pair : GameplayTags.DamageTypesToDebuffs)
+	for (const FAuraDamageTypeCapture& Capture : DamageTypeCaptures())
 	{
-		const FGameplayTag& DamageType = Pair.Key;
-		const FGameplayTag& DebuffType = Pair.Value;
+		const FGameplayTag& DamageType = Capture.DamageType;
 		const float TypeDamage = Spec.GetSetByCallerMagnitude(DamageType, false, -1.0f);
 		if (TypeDamage > -0.5f) // 0.5 padding for floating point [im]precision.
 		{
@@ -81,9 +122,8 @@ void UExecCalc_Damage::DetermineDebuff(const FGameplayEffectCustomExecutionParam
 			const float SourceDebuffChance = Spec.GetSetByCallerMagnitude(GameplayTags.Debuff_Chance, false, -1.0f);
 
 			float TargetDebuffResistance = 0.0f;
-			const FGameplayTag& ResistanceTag = GameplayTags.DamageTypesToResistances[DamageType];
 			ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(
-				InTagsToDefs[ResistanceTag],
+				Capture.ResistanceDef,
 				EvaluationParameters,
 				TargetDebuffResistance
 			);
@@ -114,21 +154,6 @@ void UExecCalc_Damage::DetermineDebuff(const FGameplayEffectCustomExecutionParam
 void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
                                               FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
 {
-	const FAuraGameplayTags& Tags = FAuraGameplayTags::Get();
-	TMap<FGameplayTag, FGameplayEffectAttributeCaptureDefinition> TagsToCaptureDefs;
-
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_Armor, DamageStatics().ArmorDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_BlockChance, DamageStatics().BlockChanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_ArmorPenetration, DamageStatics().ArmorPenetrationDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_CriticalHitChance, DamageStatics().CriticalHitChanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_CriticalHitResistance, DamageStatics().CriticalHitResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_CriticalHitDamage, DamageStatics().CriticalHitDamageDef);
-
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Fire, DamageStatics().FireResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Lightning, DamageStatics().LightningResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Arcane, DamageStatics().ArcaneResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Physical, DamageStatics().PhysicalResistanceDef);
-
 	const UAbilitySystemComponent* SourceASC = ExecutionParams.GetSourceAbilitySystemComponent();
 	const UAbilitySystemComponent* TargetASC = ExecutionParams.GetTargetAbilitySystemComponent();
 
@@ -155,27 +180,16 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	EvaluationParameters.TargetTags = TargetTags;
 
 	// Debuff.
-	DetermineDebuff(ExecutionParams, Spec, EvaluationParameters, TagsToCaptureDefs);
+	DetermineDebuff(ExecutionParams, Spec, EvaluationParameters);
 
 	// Get Damage Set by Caller Magnitude.
 	float Damage = 0.0f;
-	for (const TTuple<FGameplayTag, FGameplayTag>& Pair : FAuraGameplayTags::Get().DamageTypesToResistances)
+	for (const FAuraDamageTypeCapture& Capture : DamageTypeCaptures())
 	{
-		const FGameplayTag DamageTypeTag = Pair.Key;
-		const FGameplayTag ResistanceTag = Pair.Value;
-
-		checkf(
-			TagsToCaptureDefs.Contains(ResistanceTag),
-			TEXT("TagsToCaptureDefs doesn't contain Tag: [%s] in ExecCalc_Damage"),
-			*ResistanceTag.ToString()
-		);
-
-		const FGameplayEffectAttributeCaptureDefinition CaptureDef = TagsToCaptureDefs[ResistanceTag];
-
-		float DamageTypeValue = Spec.GetSetByCallerMagnitude(DamageTypeTag, false);
+		float DamageTypeValue = Spec.GetSetByCallerMagnitude(Capture.DamageType, false);
 
 		float Resistance = 0.0f;
-		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(CaptureDef, EvaluationParameters, Resistance);
+		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(Capture.ResistanceDef, EvaluationParameters, Resistance);
 		Resistance = FMath::Clamp(Resistance, 0.0f, 100.0f);
 
 		DamageTypeValue *= ( 100.f - Resistance ) / 100.0f;
@@ -205,20 +219,16 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().ArmorPenetrationDef, EvaluationParameters, SourceArmorPenetration);
 	SourceArmorPenetration = FMath::Max<float>(SourceArmorPenetration, 0.0f);
 
-	const UCharacterClassInfo* CharacterClassInfo = UAuraAbilitySystemLibrary::GetCharacterClassInfo(SourceAvatar);
+	UCharacterClassInfo* CharacterClassInfo = UAuraAbilitySystemLibrary::GetCharacterClassInfo(SourceAvatar);
+	const FDamageCalculationCoefficients SourceCoefficients = CharacterClassInfo->GetDamageCalculationCoefficients(SourcePlayerLevel);
+	const FDamageCalculationCoefficients TargetCoefficients = CharacterClassInfo->GetDamageCalculationCoefficients(TargetPlayerLevel);
 
-	const FRealCurve* ArmorPenetrationCurve = CharacterClassInfo->DamageCalculationCoefficients->FindCurve(
-		FName("ArmorPenetration"), FString()
-	);
-	const float ArmorPenetrationCoefficient = ArmorPenetrationCurve->Eval(SourcePlayerLevel);
+	const float ArmorPenetrationCoefficient = SourceCoefficients.ArmorPenetration;
 
 	// ArmorPenetration ignores a percentage of the Target's Armor.
 	const float EffectiveArmor = TargetArmor * ( 100.0f - SourceArmorPenetration * ArmorPenetrationCoefficient ) / 100.0f;
 
-	const FRealCurve* EffectiveArmorCurve = CharacterClassInfo->DamageCalculationCoefficients->FindCurve(
-		FName("EffectiveArmor"), FString()
-	);
-	const float EffectiveArmorCoefficient = EffectiveArmorCurve->Eval(TargetPlayerLevel);
+	const float EffectiveArmorCoefficient = TargetCoefficients.EffectiveArmor;
 
 	// Armor ignores a percentage of incoming Damage.
 	Damage *= ( 100.0f - EffectiveArmor * EffectiveArmorCoefficient ) / 100.0f;
@@ -235,10 +245,7 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().CriticalHitDamageDef, EvaluationParameters, SourceCriticalHitDamage);
 	SourceCriticalHitDamage = FMath::Max<float>(SourceCriticalHitDamage, 0.0f);
 
-	const FRealCurve* CriticalHitResistanceCurve = CharacterClassInfo->DamageCalculationCoefficients->FindCurve(
-		FName("CriticalHitResistance"), FString()
-	);
-	const float CriticalHitResistanceCoefficient = CriticalHitResistanceCurve->Eval(TargetPlayerLevel);
+	const float CriticalHitResistanceCoefficient = TargetCoefficients.CriticalHitResistance;
 
 	// Critical Hit Resistance reduces Critical Hit Chance by a certain percentage.
 	const float EffectiveCriticalHitChance = SourceCriticalHitChance - TargetCriticalHitResistance * CriticalHitResistanceCoefficient;
@@ -5,6 +5,7 @@
 
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
 
 
 AAuraEffectActor::AAuraEffectActor()
@@ -25,7 +26,7 @@ void AAuraEffectActor::ApplyEffectToTarget(AActor* TargetActor, TSubclassOf<UGam
 	 * If the `TargetActor` is an enemy and we're not supposed to apply the current effect to enemies,
 	 * then skip this effect's application.
 	 */
-	if (TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectsToEnemies) return;
+	if (UAuraAbilitySystemLibrary::GetActorTeam(TargetActor) == EAuraTeam::Enemy && !bApplyEffectsToEnemies) return;
 
 	UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor);
 	if (TargetASC == nullptr) return;
@@ -54,7 +55,7 @@ void AAuraEffectActor::OnOverlap(AActor* TargetActor)
 	 * If the `TargetActor` is an enemy and we're not supposed to apply the current effect to enemies,
 	 * then skip this effect's application.
 	 */
-	if (TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectsToEnemies) return;
+	if (UAuraAbilitySystemLibrary::GetActorTeam(TargetActor) == EAuraTeam::Enemy && !bApplyEffectsToEnemies) return;
 
 	if (InstantEffectApplicationPolicy == EEffectApplicationPolicy::ApplyOnOverlap)
 	{
@@ -76,7 +77,7 @@ void AAuraEffectActor::OnEndOverlap(AActor* TargetActor)
 	 * If the `TargetActor` is an enemy and we're not supposed to apply the current effect to enemies,
 	 * then skip this effect's application.
 	 */
-	if (TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectsToEnemies) return;
+	if (UAuraAbilitySystemLibrary::GetActorTeam(TargetActor) == EAuraTeam::Enemy && !bApplyEffectsToEnemies) return;
 
 	if (InstantEffectApplicationPolicy == EEffectApplicationPolicy::ApplyOnEndOverlap)
 	{
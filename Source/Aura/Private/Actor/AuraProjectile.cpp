@@ -7,11 +7,13 @@
 #include "AbilitySystemComponent.h"
 #include "NiagaraFunctionLibrary.h"
 #include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "Actor/AuraProjectileMovementComponent.h"
+#include "Actor/AuraProjectilePoolSubsystem.h"
 #include "Aura/Aura.h"
 #include "Components/AudioComponent.h"
 #include "Components/SphereComponent.h"
-#include "GameFramework/ProjectileMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Net/UnrealNetwork.h"
 
 AAuraProjectile::AAuraProjectile()
 {
@@ -27,7 +29,7 @@ AAuraProjectile::AAuraProjectile()
 	Sphere->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Overlap);
 	Sphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
 
-	ProjectileMovement = CreateDefaultSubobject<UProjectileMovementComponent>("ProjectileMovement");
+	ProjectileMovement = CreateDefaultSubobject<UAuraProjectileMovementComponent>("ProjectileMovement");
 	ProjectileMovement->InitialSpeed = 550.0f;
 	ProjectileMovement->MaxSpeed = 550.0f;
 	ProjectileMovement->ProjectileGravityScale = 0.0f;
@@ -54,16 +56,133 @@ void AAuraProjectile::Destroyed()
 	Super::Destroyed();
 }
 
-void AAuraProjectile::BeginPlay()
+void AAuraProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
-	Super::BeginPlay();
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	/** To correct the projectile movement on client side. */
-	SetReplicateMovement(true);
+	DOREPLIFETIME(AAuraProjectile, ParkSerial);
+}
+
+void AAuraProjectile::Park()
+{
+	if (!HasAuthority() || bParked) return;
+
+	bParked = true;
+	++ParkSerial;
+
+	/** Clear the lifespan timer, it'll be set again on `Unpark()`. */
+	SetLifeSpan(0.0f);
+
+	SetActorHiddenInGame(true);
+	DeactivateProjectile();
+	ResetLaunchState();
+
+	/**
+	 * Make sure the final state (hidden & parked) reaches the clients, after that there's nothing to replicate
+	 * while the projectile sits in the pool so it goes dormant until it's reused.
+	 */
+	ForceNetUpdate();
+	SetNetDormancy(DORM_DormantAll);
+}
+
+void AAuraProjectile::Unpark(const FTransform& SpawnTransform)
+{
+	if (!HasAuthority() || !bParked) return;
+
+	SetNetDormancy(DORM_Awake);
+
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+
+	bParked = false;
+	++ParkSerial;
+	bHit = false;
 
 	SetLifeSpan(LifeSpan);
 
-	Sphere->OnComponentBeginOverlap.AddDynamic(this, &AAuraProjectile::OnSphereOverlap);
+	SetActorHiddenInGame(false);
+	ActivateProjectile();
+
+	/** Enabling the collision may have hit something right away & parked the projectile again. */
+	if (bParked) return;
+
+	ForceNetUpdate();
+}
+
+void AAuraProjectile::OnRep_ParkSerial(uint8 OldParkSerial)
+{
+	const bool bWasParked = (OldParkSerial & 1) != 0;
+	bParked = (ParkSerial & 1) != 0;
+
+	/** Serials skipped in between mean a relaunch (and maybe another park) this client never saw on its own. */
+	const uint8 NumChanges = static_cast<uint8>(ParkSerial - OldParkSerial);
+	const bool bRelaunched = bParked ? NumChanges > 1 : NumChanges > 0;
+
+	if (bParked)
+	{
+		/**
+		 * Same as in `Destroyed()`, handle cosmetic effects if this client didn't overlap anything by itself,
+		 * but only for the flight this client actually saw.
+		 */
+		if (!bWasParked && !bRelaunched && !bHit) OnHit();
+
+		DeactivateProjectile();
+	}
+	else if (bRelaunched)
+	{
+		bHit = false;
+
+		ActivateProjectile();
+	}
+}
+
+void AAuraProjectile::DeactivateProjectile()
+{
+	SetActorEnableCollision(false);
+
+	ProjectileMovement->StopMovementImmediately();
+	ProjectileMovement->Deactivate();
+
+	if (IsValid(LoopingSoundComponent))
+	{
+		LoopingSoundComponent->Stop();
+	}
+}
+
+void AAuraProjectile::ActivateProjectile()
+{
+	/** Same as the initial velocity set by `UProjectileMovementComponent::InitializeComponent()` on spawn. */
+	ProjectileMovement->SetUpdatedComponent(GetRootComponent());
+	ProjectileMovement->Velocity = GetActorForwardVector() * ProjectileMovement->InitialSpeed;
+	ProjectileMovement->Activate(true);
+
+	StartLoopingSound();
+
+	/**
+	 * Last, since enabling the collision can overlap something right away & park the projectile again
+	 * (through `OnSphereOverlap()`), which must not be undone by anything above.
+	 */
+	SetActorEnableCollision(true);
+}
+
+void AAuraProjectile::ResetLaunchState()
+{
+	DamageEffectParams = FDamageEffectParams();
+
+	/** Restore whatever homing setup the projectile class has by default, the spawning ability may override it again. */
+	const AAuraProjectile* DefaultProjectile = GetClass()->GetDefaultObject<AAuraProjectile>();
+	ProjectileMovement->HomingTargetComponent = nullptr;
+	ProjectileMovement->bIsHomingProjectile = DefaultProjectile->ProjectileMovement->bIsHomingProjectile;
+	ProjectileMovement->HomingAccelerationMagnitude = DefaultProjectile->ProjectileMovement->HomingAccelerationMagnitude;
+	ProjectileMovement->ClearHomingTargetLocation();
+}
+
+void AAuraProjectile::StartLoopingSound()
+{
+	if (IsValid(LoopingSoundComponent))
+	{
+		LoopingSoundComponent->Play();
+		return;
+	}
 
 	/**
 	 * Make a looping sound that'll be played once projectile is spawned.
@@ -71,16 +190,56 @@ void AAuraProjectile::BeginPlay()
 	 */
 	LoopingSoundComponent = UGameplayStatics::SpawnSoundAttached(LoopingSound, GetRootComponent());
 
-	/** Automatically set to stop the sound when this projectile actor is destroyed. */
 	if (IsValid(LoopingSoundComponent))
 	{
+		/** Automatically set to stop the sound when this projectile actor is destroyed. */
 		LoopingSoundComponent->bStopWhenOwnerDestroyed = true;
+
+		/** Keep the component around after it's stopped, so that it can be played again once the projectile is reused. */
+		LoopingSoundComponent->bAutoDestroy = false;
 	}
 }
 
+void AAuraProjectile::ReleaseToPool()
+{
+	if (UAuraProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<UAuraProjectilePoolSubsystem>())
+	{
+		ProjectilePool->ReleaseProjectile(this);
+	}
+	else Destroy();
+}
+
+void AAuraProjectile::BeginPlay()
+{
+	Super::BeginPlay();
+
+	/** To correct the projectile movement on client side. */
+	SetReplicateMovement(true);
+
+	SetLifeSpan(LifeSpan);
+
+	Sphere->OnComponentBeginOverlap.AddDynamic(this, &AAuraProjectile::OnSphereOverlap);
+
+	StartLoopingSound();
+}
+
+void AAuraProjectile::LifeSpanExpired()
+{
+	if (HasAuthority())
+	{
+		ReleaseToPool();
+		return;
+	}
+
+	Super::LifeSpanExpired();
+}
+
 void AAuraProjectile::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
                                       UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
+	/** Parked projectiles have their collision disabled, but an overlap may still be pending in the same frame. */
+	if (bParked) return;
+
 	/** To prevent the access violation error on client side. */
 	if (!IsValid(DamageEffectParams.SourceAbilitySystemComponent)) return;
 
@@ -131,8 +290,8 @@ void AAuraProjectile::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent,
 			UAuraAbilitySystemLibrary::ApplyDamageEffect(DamageEffectParams);
 		}
 
-		/** Destroy the object since we're on the server. */
-		Destroy();
+		/** Return the projectile to the pool (or destroy it) since we're on the server. */
+		ReleaseToPool();
 	}
 	else bHit = true; /** Set this on the client. */
 }
@@ -142,10 +301,10 @@ void AAuraProjectile::OnHit()
 	UGameplayStatics::PlaySoundAtLocation(this, ImpactSound, GetActorLocation(), FRotator::ZeroRotator);
 	UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, ImpactEffect, GetActorLocation());
 
+	/** Only stop the looping sound, the component is kept for when this projectile gets reused from the pool. */
 	if (IsValid(LoopingSoundComponent) && LoopingSoundComponent->IsPlaying())
 	{
 		LoopingSoundComponent->Stop();
-		LoopingSoundComponent->DestroyComponent();
 	}
 
 	bHit = true;
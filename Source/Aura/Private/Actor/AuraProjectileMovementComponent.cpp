@@ -0,0 +1,42 @@
+// Copyright - Amey Chavan
+
+
+#include "Actor/AuraProjectileMovementComponent.h"
+
+
+void UAuraProjectileMovementComponent::SetHomingTargetLocation(const FVector& InHomingTargetLocation)
+{
+	HomingTargetLocation = InHomingTargetLocation;
+	bHomingToLocation = true;
+}
+
+void UAuraProjectileMovementComponent::ClearHomingTargetLocation()
+{
+	HomingTargetLocation = FVector::ZeroVector;
+	bHomingToLocation = false;
+}
+
+FVector UAuraProjectileMovementComponent::ComputeAcceleration(const FVector& InVelocity, float DeltaTime) const
+{
+	FVector Acceleration = Super::ComputeAcceleration(InVelocity, DeltaTime);
+
+	/** The parent class only adds the homing acceleration when there's a valid `HomingTargetComponent`. */
+	if (bIsHomingProjectile && bHomingToLocation && !HomingTargetComponent.IsValid())
+	{
+		Acceleration += ComputeHomingAcceleration(InVelocity, DeltaTime);
+	}
+
+	return Acceleration;
+}
+
+FVector UAuraProjectileMovementComponent::ComputeHomingAcceleration(const FVector& InVelocity, float DeltaTime) const
+{
+	if (HomingTargetComponent.IsValid() || !bHomingToLocation)
+	{
+		return Super::ComputeHomingAcceleration(InVelocity, DeltaTime);
+	}
+
+	/** Same as the parent class, just with the stored location instead of the target component's location. */
+	const FVector HomingAcceleration = (HomingTargetLocation - UpdatedComponent->GetComponentLocation()).GetSafeNormal() * HomingAccelerationMagnitude;
+	return HomingAcceleration;
+}
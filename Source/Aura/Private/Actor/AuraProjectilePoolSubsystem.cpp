@@ -0,0 +1,89 @@
+// Copyright - Amey Chavan
+
+
+#include "Actor/AuraProjectilePoolSubsystem.h"
+
+#include "Actor/AuraProjectile.h"
+#include "Aura/Aura.h"
+
+DECLARE_CYCLE_STAT(TEXT("Acquire Projectile"), STAT_AuraAcquireProjectile, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Projectiles Spawned"), STAT_AuraProjectilesSpawned, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Projectiles Reused"), STAT_AuraProjectilesReused, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Projectiles Destroyed"), STAT_AuraProjectilesDestroyed, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Projectiles Parked"), STAT_AuraProjectilesParked, STATGROUP_Aura);
+
+void UAuraProjectilePoolSubsystem::Deinitialize()
+{
+	for (const TPair<TSubclassOf<AAuraProjectile>, TArray<TWeakObjectPtr<AAuraProjectile>>>& Pair : ParkedProjectiles)
+	{
+		DEC_DWORD_STAT_BY(STAT_AuraProjectilesParked, Pair.Value.Num());
+	}
+	ParkedProjectiles.Empty();
+
+	Super::Deinitialize();
+}
+
+AAuraProjectile* UAuraProjectilePoolSubsystem::AcquireProjectile(TSubclassOf<AAuraProjectile> ProjectileClass,
+	const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraAcquireProjectile);
+
+	if (TArray<TWeakObjectPtr<AAuraProjectile>>* Parked = ParkedProjectiles.Find(ProjectileClass))
+	{
+		while (!Parked->IsEmpty())
+		{
+			AAuraProjectile* Projectile = Parked->Pop(false).Get();
+			DEC_DWORD_STAT(STAT_AuraProjectilesParked);
+
+			/** Skip the projectiles which were destroyed by something else while they were parked. */
+			if (!IsValid(Projectile)) continue;
+
+			Projectile->SetOwner(Owner);
+			Projectile->SetInstigator(Instigator);
+
+			INC_DWORD_STAT(STAT_AuraProjectilesReused);
+			return Projectile;
+		}
+	}
+
+	INC_DWORD_STAT(STAT_AuraProjectilesSpawned);
+
+	return GetWorld()->SpawnActorDeferred<AAuraProjectile>(
+		ProjectileClass,
+		SpawnTransform,
+		Owner,
+		Instigator,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+	);
+}
+
+void UAuraProjectilePoolSubsystem::LaunchProjectile(AAuraProjectile* Projectile, const FTransform& SpawnTransform)
+{
+	if (!IsValid(Projectile)) return;
+
+	/** A projectile coming from `SpawnActorDeferred()` has not begun play yet, so it only needs to finish spawning. */
+	if (!Projectile->HasActorBegunPlay())
+	{
+		Projectile->FinishSpawning(SpawnTransform);
+		return;
+	}
+
+	Projectile->Unpark(SpawnTransform);
+}
+
+void UAuraProjectilePoolSubsystem::ReleaseProjectile(AAuraProjectile* Projectile)
+{
+	if (!IsValid(Projectile) || Projectile->IsParked()) return;
+
+	TArray<TWeakObjectPtr<AAuraProjectile>>& Parked = ParkedProjectiles.FindOrAdd(Projectile->GetClass());
+	if (Parked.Num() >= MaxParkedProjectilesPerClass)
+	{
+		INC_DWORD_STAT(STAT_AuraProjectilesDestroyed);
+		Projectile->Destroy();
+		return;
+	}
+
+	Projectile->Park();
+	Parked.Add(Projectile);
+	INC_DWORD_STAT(STAT_AuraProjectilesParked);
+}
@@ -1,6 +1,99 @@
 ﻿
 #include "AuraAbilityTypes.h"
 
+#include "AuraGameplayTags.h"
+#include "Engine/NetSerialization.h"
+
+namespace AuraEffectContextSerialization
+{
+	/** Debuff damage, duration & frequency are sent as packed fixed point with this many steps per unit. */
+	constexpr float DebuffValueScale = 100.0f;
+
+	/** Damage types are sent as an index into `GetDamageTypes()`, with this one meaning any other tag sent in full. */
+	constexpr uint32 OtherDamageTypeIndex = 7;
+	constexpr int32 DamageTypeIndexBits = 3;
+
+	static_assert(OtherDamageTypeIndex == (1 << DamageTypeIndexBits) - 1, "The other damage type index must be the largest one.");
+
+	/**
+	 * Built once from the damage types with a resistance, so a new damage type gets an index without touching this file.
+	 * Sorted by name, so the server & the clients agree on the indices whatever order the tags were added in.
+	 */
+	const TArray<FGameplayTag>& GetDamageTypes()
+	{
+		static const TArray<FGameplayTag> DamageTypes = []
+		{
+			TArray<FGameplayTag> Result;
+			FAuraGameplayTags::Get().DamageTypesToResistances.GetKeys(Result);
+			Result.Sort([](const FGameplayTag& A, const FGameplayTag& B) { return A.GetTagName().LexicalLess(B.GetTagName()); });
+
+			checkf(Result.Num() <= static_cast<int32>(OtherDamageTypeIndex), TEXT("%d damage types don't fit in %d bits, increase DamageTypeIndexBits."), Result.Num(), DamageTypeIndexBits);
+			return Result;
+		}();
+
+		return DamageTypes;
+	}
+
+	void SerializeDebuffValue(FArchive& Ar, float& Value)
+	{
+		uint32 QuantizedValue = Ar.IsSaving() ? static_cast<uint32>(FMath::RoundToInt(FMath::Max(Value, 0.0f) * DebuffValueScale)) : 0;
+		Ar.SerializeIntPacked(QuantizedValue);
+
+		if (Ar.IsLoading())
+		{
+			Value = QuantizedValue / DebuffValueScale;
+		}
+	}
+
+	/** Impulses are sent as a 16-bit per component direction & a packed magnitude, rounded to whole units. */
+	void SerializeImpulse(FArchive& Ar, FVector& Impulse)
+	{
+		FVector Direction = FVector::ZeroVector;
+		uint32 Magnitude = 0;
+		if (Ar.IsSaving())
+		{
+			double Length = 0.0;
+			Impulse.ToDirectionAndLength(Direction, Length);
+			Magnitude = static_cast<uint32>(FMath::RoundToInt(FMath::Min(Length, static_cast<double>(MAX_int32))));
+		}
+
+		SerializeFixedVector<1, 16>(Direction, Ar);
+		Ar.SerializeIntPacked(Magnitude);
+
+		if (Ar.IsLoading())
+		{
+			Impulse = Direction * Magnitude;
+		}
+	}
+
+	void SerializeDamageType(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess, TSharedPtr<FGameplayTag>& DamageType)
+	{
+		const TArray<FGameplayTag>& DamageTypes = GetDamageTypes();
+
+		uint32 DamageTypeIndex = OtherDamageTypeIndex;
+		if (Ar.IsSaving())
+		{
+			const int32 FoundIndex = DamageTypes.IndexOfByKey(*DamageType);
+			DamageTypeIndex = FoundIndex != INDEX_NONE ? static_cast<uint32>(FoundIndex) : OtherDamageTypeIndex;
+		}
+
+		Ar.SerializeBits(&DamageTypeIndex, DamageTypeIndexBits);
+
+		if (Ar.IsLoading() && !DamageType.IsValid())
+		{
+			DamageType = MakeShared<FGameplayTag>();
+		}
+
+		if (DamageTypeIndex == OtherDamageTypeIndex)
+		{
+			DamageType->NetSerialize(Ar, Map, bOutSuccess);
+		}
+		else if (Ar.IsLoading())
+		{
+			*DamageType = DamageTypes.IsValidIndex(DamageTypeIndex) ? DamageTypes[DamageTypeIndex] : FGameplayTag();
+		}
+	}
+}
 
 bool FAuraGameplayEffectContext::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
@@ -120,52 +213,48 @@ bool FAuraGameplayEffectContext::NetSerialize(FArchive& Ar, class UPackageMap* M
 	{
 		bHasWorldOrigin = false;
 	}
-	if (RepBits & (1 << 7))
-	{
-		Ar << bIsBlockedHit;
-	}
-	if (RepBits & (1 << 8))
-	{
-		Ar << bIsCriticalHit;
-	}
-	if (RepBits & (1 << 9))
+
+	/** The flags are carried by their `RepBits` alone. */
+	if (Ar.IsLoading())
 	{
-		Ar << bIsSuccessfulDebuff;
+		bIsBlockedHit = (RepBits & (1 << 7)) != 0;
+		bIsCriticalHit = (RepBits & (1 << 8)) != 0;
+		bIsSuccessfulDebuff = (RepBits & (1 << 9)) != 0;
+
+		/** Everything below is zero (or unset) unless its bit is set, same as on the saving side. */
+		DebuffDamage = 0.0f;
+		DebuffDuration = 0.0f;
+		DebuffFrequency = 0.0f;
+		DeathImpulse = FVector::ZeroVector;
+		KnockbackForce = FVector::ZeroVector;
+		if (!(RepBits & (1 << 13)))
+		{
+			DamageType.Reset();
+		}
 	}
 	if (RepBits & (1 << 10))
 	{
-		Ar << DebuffDamage;
+		AuraEffectContextSerialization::SerializeDebuffValue(Ar, DebuffDamage);
 	}
 	if (RepBits & (1 << 11))
 	{
-		Ar << DebuffDuration;
+		AuraEffectContextSerialization::SerializeDebuffValue(Ar, DebuffDuration);
 	}
 	if (RepBits & (1 << 12))
 	{
-		Ar << DebuffFrequency;
+		AuraEffectContextSerialization::SerializeDebuffValue(Ar, DebuffFrequency);
 	}
 	if (RepBits & (1 << 13))
 	{
-		if (Ar.IsLoading())
-		{
-			if (!DamageType.IsValid())
-			{
-				DamageType = TSharedPtr<FGameplayTag>(new FGameplayTag());
-				/**
-				 * Or we can write the above line as,
-				 * DamageType = MakeShared<FGameplayTag>();
-				 */
-			}
-		}
-		DamageType->NetSerialize(Ar, Map, bOutSuccess);
+		AuraEffectContextSerialization::SerializeDamageType(Ar, Map, bOutSuccess, DamageType);
 	}
 	if (RepBits & (1 << 14))
 	{
-		DeathImpulse.NetSerialize(Ar, Map, bOutSuccess);
+		AuraEffectContextSerialization::SerializeImpulse(Ar, DeathImpulse);
 	}
 	if (RepBits & (1 << 15))
 	{
-		KnockbackForce.NetSerialize(Ar, Map, bOutSuccess);
+		AuraEffectContextSerialization::SerializeImpulse(Ar, KnockbackForce);
 	}
 
 	if (Ar.IsLoading())
@@ -90,6 +90,11 @@ void FAuraGameplayTags::InitializeNativeGameplayTags()
 	 * Input Tags
 	 */
 
+	GameplayTags.InputTag = UGameplayTagsManager::Get().AddNativeGameplayTag(
+		FName("InputTag"),
+		FString("Parent of all Input Tags")
+	);
+
 	GameplayTags.InputTag_LMB = UGameplayTagsManager::Get().AddNativeGameplayTag(
 		FName("InputTag.LMB"),
 		FString("Input Tag for Left Mouse Button")
@@ -297,6 +302,11 @@ void FAuraGameplayTags::InitializeNativeGameplayTags()
 	 * Abilities
 	 */
 
+	GameplayTags.Abilities = UGameplayTagsManager::Get().AddNativeGameplayTag(
+		FName("Abilities"),
+		FString("Parent of all Ability Tags")
+	);
+
 	GameplayTags.Abilities_None = UGameplayTagsManager::Get().AddNativeGameplayTag(
 		FName("Abilities.None"),
 		FString("No Ability - like the nullptr for the Ability Tags")
@@ -317,6 +327,11 @@ void FAuraGameplayTags::InitializeNativeGameplayTags()
 		FString("Hit React Ability")
 	);
 
+	GameplayTags.Abilities_Status = UGameplayTagsManager::Get().AddNativeGameplayTag(
+		FName("Abilities.Status"),
+		FString("Parent of all Ability Status Tags")
+	);
+
 	GameplayTags.Abilities_Status_Eligible = UGameplayTagsManager::Get().AddNativeGameplayTag(
 		FName("Abilities.Status.Eligible"),
 		FString("Eligible Status")
@@ -17,6 +17,8 @@
 
 AAuraCharacter::AAuraCharacter()
 {
+	Team = EAuraTeam::Player;
+
 	CameraBoom = CreateDefaultSubobject<USpringArmComponent>("CameraBoom");
 	CameraBoom->SetupAttachment(GetRootComponent());
 	CameraBoom->SetUsingAbsoluteRotation(true);
@@ -10,6 +10,7 @@
 #include "AbilitySystem/Passive/PassiveNiagaraComponent.h"
 #include "Aura/Aura.h"
 #include "Components/CapsuleComponent.h"
+#include "Game/AuraCombatantGridSubsystem.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
@@ -56,6 +57,21 @@ void AAuraCharacterBase::BeginPlay()
 	Super::BeginPlay();
 
 	GetCharacterMovement()->MaxWalkSpeed = BaseWalkSpeed;
+
+	if (UAuraCombatantGridSubsystem* CombatantGrid = GetWorld()->GetSubsystem<UAuraCombatantGridSubsystem>())
+	{
+		CombatantGrid->RegisterCombatant(this);
+	}
+}
+
+void AAuraCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAuraCombatantGridSubsystem* CombatantGrid = GetWorld()->GetSubsystem<UAuraCombatantGridSubsystem>())
+	{
+		CombatantGrid->UnregisterCombatant(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AAuraCharacterBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
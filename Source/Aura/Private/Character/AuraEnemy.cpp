@@ -11,12 +11,52 @@
 #include "UI/Widget/AuraUserWidget.h"
 #include "AuraGameplayTags.h"
 #include "AI/AuraAIController.h"
+#include "AI/AuraBehaviorTreeComponent.h"
 #include "BehaviorTree/BehaviorTree.h"
+#include "BrainComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
+#include "Game/AuraReplicationGraph.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemy Blackboard Writes"), STAT_AuraEnemyBlackboardWrites, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemy Dormancy Flushes"), STAT_AuraEnemyDormancyFlushes, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemies Net Dormant"), STAT_AuraEnemiesNetDormant, STATGROUP_Aura);
+
+namespace AuraEnemySignificance
+{
+	struct FSettings
+	{
+		float BehaviorTreeTickInterval;
+		float MovementTickInterval;
+		float MeshTickInterval;
+		bool bPauseBehaviorTree;
+		float NetUpdateFrequency;
+		bool bNetDormant;
+		float NetCullDistance;
+	};
+
+	/**
+	 * Per `EAuraAISignificance` bucket, a zero tick interval means ticking every frame
+	 * & a zero net update frequency or cull distance means the one set up on the class.
+	 * `Dormant` enemies don't move (their behavior tree is paused), so they stop replicating altogether.
+	 * The buckets are picked by the distance to the nearest player, so the `Low` & `Dormant` enemies are still relevant
+	 * to that player a bit past the last bucket distance (6000) but not to the players further away.
+	 */
+	constexpr FSettings Settings[] =
+	{
+		/* High */		{ 0.0f, 0.0f, 0.0f, false, 0.0f, false, 0.0f },
+		/* Medium */	{ 0.1f, 0.033f, 0.033f, false, 30.0f, false, 0.0f },
+		/* Low */		{ 0.25f, 0.1f, 0.1f, false, 10.0f, false, 8000.0f },
+		/* Dormant */	{ 0.5f, 0.5f, 0.5f, true, 10.0f, true, 8000.0f }
+	};
+	static_assert(UE_ARRAY_COUNT(Settings) == static_cast<uint8>(EAuraAISignificance::MAX), "Every significance needs its settings.");
+}
+
 AAuraEnemy::AAuraEnemy()
 {
+	Team = EAuraTeam::Enemy;
+
 	GetMesh()->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
 
 	AbilitySystemComponent = CreateDefaultSubobject<UAuraAbilitySystemComponent>("AbilitySystemComponent");
@@ -61,12 +101,23 @@ void AAuraEnemy::BeginPlay()
 			[this](const FOnAttributeChangeData& Data)
 			{
 				OnHealthChanged.Broadcast(Data.NewValue);
+
+				/** Damage wakes the enemy up, the rest (e.g. regeneration) is only sent once. */
+				if (Data.NewValue < Data.OldValue)
+				{
+					WakeUp();
+				}
+				else
+				{
+					FlushNetDormancyIfDormant();
+				}
 			}
 		);
 		AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(AuraAS->GetMaxHealthAttribute()).AddLambda(
 			[this](const FOnAttributeChangeData& Data)
 			{
 				OnMaxHealthChanged.Broadcast(Data.NewValue);
+				FlushNetDormancyIfDormant();
 			}
 		);
 
@@ -104,15 +155,155 @@ void AAuraEnemy::PossessedBy(AController* NewController)
 	 */
 	AuraAIController->GetBlackboardComponent()->InitializeBlackboard(*BehaviorTree->BlackboardAsset);
 
+	CacheBlackboardKeys();
+
 	AuraAIController->RunBehaviorTree(BehaviorTree);
 
-	AuraAIController->GetBlackboardComponent()->SetValueAsBool(FName("HitReacting"), false);
+	if (UAuraAISignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UAuraAISignificanceSubsystem>())
+	{
+		SignificanceSubsystem->RegisterEnemy(this);
+	}
+
+	SetBlackboardValueAsBool(HitReactingKey, false);
 
 	/**
 	 * Check and set whether the character is a ranged attacker.
 	 * If it's not a Warrior then it belongs to either an Elementalist or a Ranger, and they both can do ranged attacks.
 	 */
-	AuraAIController->GetBlackboardComponent()->SetValueAsBool(FName("RangedAttacker"), CharacterClass != ECharacterClass::Warrior);
+	SetBlackboardValueAsBool(RangedAttackerKey, CharacterClass != ECharacterClass::Warrior);
+}
+
+void AAuraEnemy::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAuraAISignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UAuraAISignificanceSubsystem>())
+	{
+		SignificanceSubsystem->UnregisterEnemy(this);
+	}
+
+	if (HasAuthority() && NetDormancy == DORM_DormantAll)
+	{
+		DEC_DWORD_STAT(STAT_AuraEnemiesNetDormant);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAuraEnemy::SetAISignificance(EAuraAISignificance NewSignificance)
+{
+	if (NewSignificance == AISignificance || NewSignificance == EAuraAISignificance::MAX) return;
+
+	const AuraEnemySignificance::FSettings& OldSettings = AuraEnemySignificance::Settings[static_cast<uint8>(AISignificance)];
+	const AuraEnemySignificance::FSettings& NewSettings = AuraEnemySignificance::Settings[static_cast<uint8>(NewSignificance)];
+
+	if (AISignificance == EAuraAISignificance::High)
+	{
+		DefaultNetUpdateFrequency = NetUpdateFrequency;
+		DefaultNetCullDistanceSquared = NetCullDistanceSquared;
+	}
+	AISignificance = NewSignificance;
+
+	/**
+	 * The EQS queries are run from the behavior tree tasks, so throttling (or pausing) the behavior tree
+	 * throttles those queries as well. The tree overwrites its component's tick interval after every tick,
+	 * so the throttle goes through `UAuraBehaviorTreeComponent` instead of `SetComponentTickInterval()`.
+	 */
+	if (AuraAIController)
+	{
+		if (UBrainComponent* BrainComponent = AuraAIController->GetBrainComponent())
+		{
+			if (UAuraBehaviorTreeComponent* BehaviorTreeComponent = Cast<UAuraBehaviorTreeComponent>(BrainComponent))
+			{
+				BehaviorTreeComponent->SetMinTickInterval(NewSettings.BehaviorTreeTickInterval);
+			}
+
+			if (NewSettings.bPauseBehaviorTree && !OldSettings.bPauseBehaviorTree)
+			{
+				BrainComponent->PauseLogic(TEXT("AISignificance"));
+			}
+			else if (!NewSettings.bPauseBehaviorTree && OldSettings.bPauseBehaviorTree)
+			{
+				BrainComponent->ResumeLogic(TEXT("AISignificance"));
+			}
+		}
+	}
+
+	GetCharacterMovement()->SetComponentTickInterval(NewSettings.MovementTickInterval);
+
+	/**
+	 * Only the mesh tick rate is throttled, its visibility based anim tick option is left as set up on the class.
+	 * This runs on the server, where the enemy is rarely rendered, & the attacks need both the montage notifies and
+	 * the up to date bones for their sockets (e.g. a projectile's spawn location).
+	 */
+	GetMesh()->SetComponentTickInterval(NewSettings.MeshTickInterval);
+
+	if (HasAuthority())
+	{
+		NetUpdateFrequency = NewSettings.NetUpdateFrequency > 0.0f ? NewSettings.NetUpdateFrequency : DefaultNetUpdateFrequency;
+		UAuraReplicationGraph::NotifyNetUpdateFrequencyChanged(this);
+		NetCullDistanceSquared = NewSettings.NetCullDistance > 0.0f ? FMath::Square(NewSettings.NetCullDistance) : DefaultNetCullDistanceSquared;
+		UAuraReplicationGraph::NotifyNetCullDistanceChanged(this);
+		SetEnemyNetDormancy(NewSettings.bNetDormant ? DORM_DormantAll : DORM_Awake);
+	}
+}
+
+void AAuraEnemy::WakeUp()
+{
+	/**
+	 * Goes through the significance (instead of only the net dormancy) so that the behavior tree, the tick rates & the
+	 * replication settings all wake up together. The next significance update puts the enemy back in its distance bucket.
+	 */
+	if (bDead || !HasAuthority()) return;
+
+	SetAISignificance(EAuraAISignificance::High);
+}
+
+void AAuraEnemy::SetEnemyNetDormancy(ENetDormancy NewDormancy)
+{
+	if (NewDormancy == NetDormancy) return;
+
+	if (NewDormancy == DORM_DormantAll)
+	{
+		INC_DWORD_STAT(STAT_AuraEnemiesNetDormant);
+	}
+	else if (NetDormancy == DORM_DormantAll)
+	{
+		DEC_DWORD_STAT(STAT_AuraEnemiesNetDormant);
+	}
+
+	SetNetDormancy(NewDormancy);
+}
+
+void AAuraEnemy::FlushNetDormancyIfDormant()
+{
+	/**
+	 * Sends a change which doesn't wake the enemy up (e.g. regeneration or the end of a hit react or stun) once
+	 * & goes back to sleep, see `WakeUp()` for the ones that do.
+	 */
+	if (!HasAuthority() || NetDormancy <= DORM_Awake) return;
+
+	FlushNetDormancy();
+	INC_DWORD_STAT(STAT_AuraEnemyDormancyFlushes);
+}
+
+void AAuraEnemy::CacheBlackboardKeys()
+{
+	const UBlackboardComponent* BlackboardComponent = AuraAIController->GetBlackboardComponent();
+
+	HitReactingKey = BlackboardComponent->GetKeyID(FName("HitReacting"));
+	RangedAttackerKey = BlackboardComponent->GetKeyID(FName("RangedAttacker"));
+	DeadKey = BlackboardComponent->GetKeyID(FName("Dead"));
+	StunnedKey = BlackboardComponent->GetKeyID(FName("Stunned"));
+}
+
+void AAuraEnemy::SetBlackboardValueAsBool(FBlackboard::FKey KeyID, bool bValue) const
+{
+	if (KeyID == FBlackboard::InvalidKey || AuraAIController == nullptr) return;
+
+	if (UBlackboardComponent* BlackboardComponent = AuraAIController->GetBlackboardComponent())
+	{
+		BlackboardComponent->SetValue<UBlackboardKeyType_Bool>(KeyID, bValue);
+		INC_DWORD_STAT(STAT_AuraEnemyBlackboardWrites);
+	}
 }
 
 void AAuraEnemy::HighlightActor()
@@ -142,17 +333,42 @@ void AAuraEnemy::Die(const FVector& DeathImpulse)
 {
 	SetLifeSpan(LifeSpan);
 
-	if (AuraAIController)
+	if (UAuraAISignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UAuraAISignificanceSubsystem>())
 	{
-		AuraAIController->GetBlackboardComponent()->SetValueAsBool(FName("Dead"), true);
+		SignificanceSubsystem->UnregisterEnemy(this);
 	}
 
+	/**
+	 * The body ragdolls & dissolves at full rate whatever the significance was, while the behavior tree stays as it is
+	 * (paused for a `Dormant` enemy) since it has nothing left to do.
+	 */
+	GetCharacterMovement()->SetComponentTickInterval(0.0f);
+	GetMesh()->SetComponentTickInterval(0.0f);
+
+	SetBlackboardValueAsBool(DeadKey, true);
+
 	Super::Die(DeathImpulse);
+
+	/**
+	 * The clients ragdoll & dissolve the body on their own from `MulticastHandleDeath()`, which is already sent,
+	 * so the body doesn't need to replicate anything but its destruction once `LifeSpan` runs out.
+	 */
+	NetUpdateFrequency = DeadNetUpdateFrequency;
+	UAuraReplicationGraph::NotifyNetUpdateFrequencyChanged(this);
+	NetCullDistanceSquared = FMath::Square(DeadNetCullDistance);
+	UAuraReplicationGraph::NotifyNetCullDistanceChanged(this);
+	SetEnemyNetDormancy(DORM_DormantAll);
 }
 
 void AAuraEnemy::SetCombatTarget_Implementation(AActor* InCombatTarget)
 {
 	CombatTarget = InCombatTarget;
+
+	/** Aggro, the enemy is about to move & attack. */
+	if (InCombatTarget)
+	{
+		WakeUp();
+	}
 }
 
 AActor* AAuraEnemy::GetCombatTarget_Implementation() const
@@ -165,9 +381,15 @@ void AAuraEnemy::HitReactTagChanged(const FGameplayTag CallbackTag, int32 NewCou
 	bHitReacting = NewCount > 0;
 	GetCharacterMovement()->MaxWalkSpeed = bHitReacting ? 0.0f : BaseWalkSpeed;
 
-	if (AuraAIController && AuraAIController->GetBlackboardComponent())
+	SetBlackboardValueAsBool(HitReactingKey, bHitReacting);
+
+	if (bHitReacting)
+	{
+		WakeUp();
+	}
+	else
 	{
-		AuraAIController->GetBlackboardComponent()->SetValueAsBool(FName("HitReacting"), bHitReacting);
+		FlushNetDormancyIfDormant();
 	}
 }
 
@@ -202,8 +424,14 @@ void AAuraEnemy::StunTagChanged(const FGameplayTag CallbackTag, int32 NewCount)
 {
 	Super::StunTagChanged(CallbackTag, NewCount);
 
-	if (AuraAIController && AuraAIController->GetBlackboardComponent())
+	SetBlackboardValueAsBool(StunnedKey, bIsStunned);
+
+	if (bIsStunned)
+	{
+		WakeUp();
+	}
+	else
 	{
-		AuraAIController->GetBlackboardComponent()->SetValueAsBool(FName("Stunned"), bIsStunned);
+		FlushNetDormancyIfDormant();
 	}
 }
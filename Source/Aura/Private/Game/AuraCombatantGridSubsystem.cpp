@@ -0,0 +1,187 @@
+// Copyright - Amey Chavan
+
+
+#include "Game/AuraCombatantGridSubsystem.h"
+
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "Aura/Aura.h"
+#include "Interaction/CombatInterface.h"
+
+DECLARE_CYCLE_STAT(TEXT("Combatant Grid Query"), STAT_AuraCombatantGridQuery, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combatant Grid Candidates Visited"), STAT_AuraCombatantGridCandidatesVisited, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Combatants In Grid"), STAT_AuraCombatantsInGrid, STATGROUP_Aura);
+
+void UAuraCombatantGridSubsystem::Deinitialize()
+{
+	TArray<AActor*> RegisteredCombatants;
+	Combatants.GetKeys(RegisteredCombatants);
+	for (AActor* Combatant : RegisteredCombatants)
+	{
+		UnregisterCombatant(Combatant);
+	}
+
+	Super::Deinitialize();
+}
+
+void UAuraCombatantGridSubsystem::RegisterCombatant(AActor* Combatant)
+{
+	if (!IsValid(Combatant) || Combatants.Contains(Combatant)) return;
+
+	ICombatInterface* CombatInterface = Cast<ICombatInterface>(Combatant);
+	USceneComponent* RootComponent = Combatant->GetRootComponent();
+	if (CombatInterface == nullptr || RootComponent == nullptr) return;
+
+	/** Dead combatants never come back, so there's no need to track them. */
+	if (ICombatInterface::Execute_IsDead(Combatant)) return;
+
+	FCombatantEntry& Entry = Combatants.Add(Combatant);
+	Entry.Location = Combatant->GetActorLocation();
+	Entry.Cell = GetCellFromLocation(Entry.Location);
+	Combatant->GetSimpleCollisionCylinder(Entry.CollisionRadius, Entry.CollisionHalfHeight);
+	Entry.Team = UAuraAbilitySystemLibrary::GetActorTeam(Combatant);
+	Entry.TransformUpdatedHandle = RootComponent->TransformUpdated.AddUObject(this, &UAuraCombatantGridSubsystem::OnCombatantTransformUpdated);
+
+	Cells.FindOrAdd(Entry.Cell).Add(Combatant);
+
+	if (Entry.Team < EAuraTeam::MAX) TeamCaches[static_cast<uint8>(Entry.Team)].Frame = TNumericLimits<uint64>::Max();
+
+	MaxCombatantCollisionRadius = FMath::Max(MaxCombatantCollisionRadius, Entry.CollisionRadius);
+
+	CombatInterface->GetOnDeathDelegate().AddUniqueDynamic(this, &UAuraCombatantGridSubsystem::OnCombatantDied);
+
+	INC_DWORD_STAT(STAT_AuraCombatantsInGrid);
+}
+
+void UAuraCombatantGridSubsystem::UnregisterCombatant(AActor* Combatant)
+{
+	FCombatantEntry Entry;
+	if (!Combatants.RemoveAndCopyValue(Combatant, Entry)) return;
+
+	/** Don't hand out the removed combatant for the rest of the frame. */
+	if (Entry.Team < EAuraTeam::MAX) TeamCaches[static_cast<uint8>(Entry.Team)].Frame = TNumericLimits<uint64>::Max();
+
+	if (TArray<AActor*, TInlineAllocator<8>>* Cell = Cells.Find(Entry.Cell))
+	{
+		Cell->RemoveSingleSwap(Combatant, false);
+		if (Cell->IsEmpty()) Cells.Remove(Entry.Cell);
+	}
+
+	if (IsValid(Combatant))
+	{
+		if (USceneComponent* RootComponent = Combatant->GetRootComponent())
+		{
+			RootComponent->TransformUpdated.Remove(Entry.TransformUpdatedHandle);
+		}
+
+		if (ICombatInterface* CombatInterface = Cast<ICombatInterface>(Combatant))
+		{
+			CombatInterface->GetOnDeathDelegate().RemoveDynamic(this, &UAuraCombatantGridSubsystem::OnCombatantDied);
+		}
+	}
+
+	DEC_DWORD_STAT(STAT_AuraCombatantsInGrid);
+}
+
+void UAuraCombatantGridSubsystem::GetLiveCombatantsWithinRadius(TArray<AActor*>& OutCombatants,
+	const TArray<AActor*>& ActorsToIgnore, float Radius, const FVector& SphereOrigin, AActor* FriendlyToActor,
+	TArray<FVector>* OutLocations) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraCombatantGridQuery);
+
+	/** Any combatant touching the sphere has its location within this extent, so only these cells need to be checked. */
+	const float QueryExtent = Radius + MaxCombatantCollisionRadius;
+	const FIntPoint MinCell = GetCellFromLocation(SphereOrigin - FVector(QueryExtent, QueryExtent, 0.0f));
+	const FIntPoint MaxCell = GetCellFromLocation(SphereOrigin + FVector(QueryExtent, QueryExtent, 0.0f));
+
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			const TArray<AActor*, TInlineAllocator<8>>* Cell = Cells.Find(FIntPoint(CellX, CellY));
+			if (Cell == nullptr) continue;
+
+			for (AActor* Combatant : *Cell)
+			{
+				INC_DWORD_STAT(STAT_AuraCombatantGridCandidatesVisited);
+
+				/**
+				 * The closest point of the capsule's inner segment to the sphere's origin. The sphere touches the capsule
+				 * when that point is within the sphere's radius plus the capsule's radius.
+				 */
+				const FCombatantEntry& Entry = Combatants.FindChecked(Combatant);
+				const float SegmentHalfLength = FMath::Max(Entry.CollisionHalfHeight - Entry.CollisionRadius, 0.0f);
+				const FVector ClosestSegmentPoint(Entry.Location.X, Entry.Location.Y,
+					FMath::Clamp(SphereOrigin.Z, Entry.Location.Z - SegmentHalfLength, Entry.Location.Z + SegmentHalfLength));
+
+				const float ReachSquared = FMath::Square(Radius + Entry.CollisionRadius);
+				if (FVector::DistSquared(ClosestSegmentPoint, SphereOrigin) > ReachSquared) continue;
+
+				if (ActorsToIgnore.Contains(Combatant)) continue;
+
+				if (IsValid(FriendlyToActor) && !UAuraAbilitySystemLibrary::IsNotFriend(FriendlyToActor, Combatant)) continue;
+
+				/** Every combatant is in exactly one cell, so there's no need for `AddUnique()` here. */
+				OutCombatants.Add(Combatant);
+				if (OutLocations) OutLocations->Add(Entry.Location);
+			}
+		}
+	}
+}
+
+TConstArrayView<FAuraCombatantLocation> UAuraCombatantGridSubsystem::GetLiveCombatantsOfTeam(EAuraTeam Team) const
+{
+	if (Team >= EAuraTeam::MAX) return {};
+
+	FTeamCache& TeamCache = TeamCaches[static_cast<uint8>(Team)];
+	if (TeamCache.Frame != GFrameCounter)
+	{
+		TeamCache.Frame = GFrameCounter;
+		TeamCache.Combatants.Reset();
+
+		for (const TPair<AActor*, FCombatantEntry>& Pair : Combatants)
+		{
+			if (Pair.Value.Team == Team)
+			{
+				TeamCache.Combatants.Add({Pair.Key, Pair.Value.Location});
+			}
+		}
+	}
+
+	return TeamCache.Combatants;
+}
+
+void UAuraCombatantGridSubsystem::OnCombatantDied(AActor* DeadActor)
+{
+	UnregisterCombatant(DeadActor);
+}
+
+void UAuraCombatantGridSubsystem::OnCombatantTransformUpdated(USceneComponent* UpdatedComponent,
+	EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	AActor* Combatant = UpdatedComponent->GetOwner();
+
+	FCombatantEntry* Entry = Combatants.Find(Combatant);
+	if (Entry == nullptr) return;
+
+	Entry->Location = UpdatedComponent->GetComponentLocation();
+
+	const FIntPoint NewCell = GetCellFromLocation(Entry->Location);
+	if (NewCell == Entry->Cell) return;
+
+	if (TArray<AActor*, TInlineAllocator<8>>* OldCell = Cells.Find(Entry->Cell))
+	{
+		OldCell->RemoveSingleSwap(Combatant, false);
+		if (OldCell->IsEmpty()) Cells.Remove(Entry->Cell);
+	}
+
+	Entry->Cell = NewCell;
+	Cells.FindOrAdd(NewCell).Add(Combatant);
+}
+
+FIntPoint UAuraCombatantGridSubsystem::GetCellFromLocation(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize)
+	);
+}
@@ -0,0 +1,101 @@
+// Copyright - Amey Chavan
+
+
+#include "Game/AuraDamageNumberSubsystem.h"
+
+#include "Aura/Aura.h"
+#include "Game/AuraReplicationGraph.h"
+#include "GameFramework/Character.h"
+#include "Player/AuraPlayerController.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Number RPCs Sent"), STAT_AuraDamageNumberRPCsSent, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Number RPCs Saved"), STAT_AuraDamageNumberRPCsSaved, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Numbers Not Relevant"), STAT_AuraDamageNumbersNotRelevant, STATGROUP_Aura);
+
+void UAuraDamageNumberSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushDamageNumbers();
+}
+
+bool UAuraDamageNumberSubsystem::IsTickable() const
+{
+	return !PendingDamageNumbers.IsEmpty();
+}
+
+TStatId UAuraDamageNumberSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraDamageNumberSubsystem, STATGROUP_Aura);
+}
+
+void UAuraDamageNumberSubsystem::AddDamageNumber(ACharacter* TargetCharacter, float Damage, bool bBlockedHit, bool bCriticalHit)
+{
+	if (!IsValid(TargetCharacter)) return;
+
+	FAuraDamageNumber& DamageNumber = PendingDamageNumbers.FindOrAdd(TargetCharacter);
+	DamageNumber.TargetCharacter = TargetCharacter;
+	DamageNumber.Damage += Damage;
+	DamageNumber.HitCount = static_cast<uint8>(FMath::Min(DamageNumber.HitCount + 1, 255));
+	DamageNumber.bBlockedHit |= bBlockedHit;
+	DamageNumber.bCriticalHit |= bCriticalHit;
+}
+
+void UAuraDamageNumberSubsystem::FlushDamageNumbers()
+{
+	TArray<FAuraDamageNumber> DamageNumbers;
+	DamageNumbers.Reserve(PendingDamageNumbers.Num());
+
+	for (const TPair<TWeakObjectPtr<ACharacter>, FAuraDamageNumber>& Pair : PendingDamageNumbers)
+	{
+		/** The target may have been destroyed since it got hit. */
+		if (!Pair.Key.IsValid()) continue;
+
+		DamageNumbers.Add(Pair.Value);
+	}
+	PendingDamageNumbers.Reset();
+
+	if (DamageNumbers.IsEmpty()) return;
+
+	TArray<FAuraDamageNumber> RelevantDamageNumbers;
+	RelevantDamageNumbers.Reserve(FMath::Min(DamageNumbers.Num(), MaxDamageNumbersPerRPC));
+
+	// Show the damage numbers and texts on each client.
+	for (FConstPlayerControllerIterator PlayerControllerIterator = GetWorld()->GetPlayerControllerIterator(); PlayerControllerIterator; ++PlayerControllerIterator)
+	{
+		AAuraPlayerController* AuraPlayerController = Cast<AAuraPlayerController>(PlayerControllerIterator->Get());
+		if (AuraPlayerController == nullptr) continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		AuraPlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		int32 NumHits = 0;
+		int32 NumRPCs = 0;
+		for (int32 Index = 0; Index < DamageNumbers.Num(); ++Index)
+		{
+			/** The client couldn't resolve a target which isn't relevant to it, so don't send it at all. */
+			const FAuraDamageNumber& DamageNumber = DamageNumbers[Index];
+			if (UAuraReplicationGraph::IsActorRelevantToViewer(DamageNumber.TargetCharacter, AuraPlayerController, ViewLocation))
+			{
+				RelevantDamageNumbers.Add(DamageNumber);
+				NumHits += DamageNumber.HitCount;
+			}
+			else
+			{
+				INC_DWORD_STAT(STAT_AuraDamageNumbersNotRelevant);
+			}
+
+			const bool bLast = Index == DamageNumbers.Num() - 1;
+			if (RelevantDamageNumbers.Num() == MaxDamageNumbersPerRPC || (bLast && !RelevantDamageNumbers.IsEmpty()))
+			{
+				AuraPlayerController->ClientShowDamageNumbers(RelevantDamageNumbers);
+				RelevantDamageNumbers.Reset();
+				++NumRPCs;
+			}
+		}
+
+		INC_DWORD_STAT_BY(STAT_AuraDamageNumberRPCsSent, NumRPCs);
+		INC_DWORD_STAT_BY(STAT_AuraDamageNumberRPCsSaved, NumHits - NumRPCs);
+	}
+}
@@ -0,0 +1,270 @@
+// Copyright - Amey Chavan
+
+
+#include "Game/AuraReplicationGraph.h"
+
+#include "Actor/AuraProjectile.h"
+#include "Aura/Aura.h"
+#include "Character/AuraEnemy.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+
+DECLARE_CYCLE_STAT(TEXT("Replication Graph Replicate Actors"), STAT_AuraReplicationGraphReplicateActors, STATGROUP_Aura);
+
+void UAuraReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	/** Baseline for the classes which aren't loaded yet, e.g. Blueprint only actors. */
+	FClassReplicationInfo ActorInfo;
+	InitClassReplicationInfo(ActorInfo, AActor::StaticClass(), true);
+	GlobalActorReplicationInfoMap.SetClassInfo(AActor::StaticClass(), ActorInfo);
+
+	for (TObjectIterator<UClass> ClassIterator; ClassIterator; ++ClassIterator)
+	{
+		UClass* Class = *ClassIterator;
+		const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject(false));
+		if (ActorCDO == nullptr || !ActorCDO->GetIsReplicated()) continue;
+
+		/** Skip the Blueprint skeleton & reinstanced classes. */
+		const FString ClassName = Class->GetName();
+		if (ClassName.StartsWith(TEXT("SKEL_")) || ClassName.StartsWith(TEXT("REINST_"))) continue;
+
+		const EAuraClassRepNodeMapping Policy = ComputeMappingPolicy(Class);
+		ClassRepNodePolicies.Set(Class, Policy);
+
+		FClassReplicationInfo ClassInfo;
+		InitClassReplicationInfo(ClassInfo, Class, Policy >= EAuraClassRepNodeMapping::Spatialize_Static);
+		GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+	}
+}
+
+void UAuraReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = GridCellSize;
+	GridNode->SpatialBias = GridSpatialBias;
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+}
+
+void UAuraReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	UAuraReplicationGraphNode_AlwaysRelevant_ForConnection* AlwaysRelevantForConnectionNode = CreateNewNode<UAuraReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(AlwaysRelevantForConnectionNode, RepGraphConnection);
+}
+
+void UAuraReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case EAuraClassRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+	case EAuraClassRepNodeMapping::RelevantOwnerConnection:
+		OwnerOnlyActors.AddUnique(ActorInfo.Actor);
+		break;
+	case EAuraClassRepNodeMapping::Spatialize_Static:
+		GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+		break;
+	case EAuraClassRepNodeMapping::Spatialize_Dynamic:
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+	case EAuraClassRepNodeMapping::Spatialize_Dormancy:
+		GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+		break;
+	default:
+		break;
+	}
+}
+
+void UAuraReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case EAuraClassRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+	case EAuraClassRepNodeMapping::RelevantOwnerConnection:
+		OwnerOnlyActors.RemoveSingleSwap(ActorInfo.Actor, false);
+		break;
+	case EAuraClassRepNodeMapping::Spatialize_Static:
+		GridNode->RemoveActor_Static(ActorInfo);
+		break;
+	case EAuraClassRepNodeMapping::Spatialize_Dynamic:
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+	case EAuraClassRepNodeMapping::Spatialize_Dormancy:
+		GridNode->RemoveActor_Dormancy(ActorInfo);
+		break;
+	default:
+		break;
+	}
+}
+
+int32 UAuraReplicationGraph::ServerReplicateActors(float DeltaSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraReplicationGraphReplicateActors);
+
+	return Super::ServerReplicateActors(DeltaSeconds);
+}
+
+void UAuraReplicationGraph::NotifyNetUpdateFrequencyChanged(const AActor* Actor)
+{
+	const UNetDriver* NetDriver = Actor ? Actor->GetNetDriver() : nullptr;
+	UAuraReplicationGraph* ReplicationGraph = NetDriver ? Cast<UAuraReplicationGraph>(NetDriver->GetReplicationDriver()) : nullptr;
+	if (ReplicationGraph == nullptr) return;
+
+	if (FGlobalActorReplicationInfo* GlobalInfo = ReplicationGraph->GlobalActorReplicationInfoMap.Find(Actor))
+	{
+		GlobalInfo->Settings.ReplicationPeriodFrame = ReplicationGraph->GetReplicationPeriodFrame(Actor->NetUpdateFrequency);
+	}
+}
+
+void UAuraReplicationGraph::NotifyNetCullDistanceChanged(AActor* Actor)
+{
+	const UNetDriver* NetDriver = Actor ? Actor->GetNetDriver() : nullptr;
+	UAuraReplicationGraph* ReplicationGraph = NetDriver ? Cast<UAuraReplicationGraph>(NetDriver->GetReplicationDriver()) : nullptr;
+	if (ReplicationGraph == nullptr) return;
+
+	FGlobalActorReplicationInfo* GlobalInfo = ReplicationGraph->GlobalActorReplicationInfoMap.Find(Actor);
+	if (GlobalInfo == nullptr) return;
+
+	const float OldCullDistance = GlobalInfo->Settings.GetCullDistance();
+	GlobalInfo->Settings.SetCullDistanceSquared(Actor->NetCullDistanceSquared);
+
+	for (UNetReplicationGraphConnection* Connection : ReplicationGraph->Connections)
+	{
+		if (FConnectionReplicationActorInfo* ConnectionInfo = Connection->ActorInfoMap.Find(Actor))
+		{
+			ConnectionInfo->SetCullDistanceSquared(Actor->NetCullDistanceSquared);
+		}
+	}
+
+	if (ReplicationGraph->GridNode)
+	{
+		ReplicationGraph->GridNode->NotifyActorCullDistChange(Actor, *GlobalInfo, OldCullDistance);
+	}
+}
+
+bool UAuraReplicationGraph::IsActorRelevantToViewer(const AActor* Actor, const APlayerController* Viewer, const FVector& ViewLocation)
+{
+	if (!IsValid(Actor) || Viewer == nullptr) return false;
+
+	const UNetDriver* NetDriver = Actor->GetNetDriver();
+	UAuraReplicationGraph* ReplicationGraph = NetDriver ? Cast<UAuraReplicationGraph>(NetDriver->GetReplicationDriver()) : nullptr;
+	if (ReplicationGraph == nullptr)
+	{
+		return Actor->IsNetRelevantFor(Viewer, Viewer->GetViewTarget(), ViewLocation);
+	}
+
+	/** Not replicated through the graph at all. */
+	const FGlobalActorReplicationInfo* GlobalInfo = ReplicationGraph->GlobalActorReplicationInfoMap.Find(Actor);
+	if (GlobalInfo == nullptr) return false;
+
+	/** The player's own pawn & the actors which aren't spatialized (no cull distance) are always relevant. */
+	if (Actor == Viewer->GetPawn() || Actor == Viewer->GetViewTarget()) return true;
+
+	const float CullDistanceSquared = GlobalInfo->Settings.GetCullDistanceSquared();
+	return CullDistanceSquared <= 0.0f || FVector::DistSquared(Actor->GetActorLocation(), ViewLocation) <= CullDistanceSquared;
+}
+
+EAuraClassRepNodeMapping UAuraReplicationGraph::GetMappingPolicy(UClass* Class)
+{
+	if (const EAuraClassRepNodeMapping* Policy = ClassRepNodePolicies.Get(Class))
+	{
+		return *Policy;
+	}
+
+	/** A class which wasn't loaded at initialization & doesn't derive from any of the classes routed then. */
+	const EAuraClassRepNodeMapping Policy = ComputeMappingPolicy(Class);
+	ClassRepNodePolicies.Set(Class, Policy);
+	return Policy;
+}
+
+EAuraClassRepNodeMapping UAuraReplicationGraph::ComputeMappingPolicy(const UClass* Class) const
+{
+	const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+	if (ActorCDO == nullptr || !ActorCDO->GetIsReplicated()) return EAuraClassRepNodeMapping::NotRouted;
+
+	if (ActorCDO->bAlwaysRelevant || Class->IsChildOf(APlayerState::StaticClass()))
+	{
+		return EAuraClassRepNodeMapping::RelevantAllConnections;
+	}
+
+	/** Always replicated to their own connection by `UAuraReplicationGraphNode_AlwaysRelevant_ForConnection`'s base class. */
+	if (Class->IsChildOf(APlayerController::StaticClass()))
+	{
+		return EAuraClassRepNodeMapping::NotRouted;
+	}
+
+	if (ActorCDO->bOnlyRelevantToOwner)
+	{
+		return EAuraClassRepNodeMapping::RelevantOwnerConnection;
+	}
+
+	/** Both go net dormant, the enemies far from the players or dead & the projectiles while parked in their pool. */
+	if (Class->IsChildOf(AAuraEnemy::StaticClass()) || Class->IsChildOf(AAuraProjectile::StaticClass()))
+	{
+		return EAuraClassRepNodeMapping::Spatialize_Dormancy;
+	}
+
+	return ActorCDO->IsReplicatingMovement() ? EAuraClassRepNodeMapping::Spatialize_Dynamic : EAuraClassRepNodeMapping::Spatialize_Static;
+}
+
+void UAuraReplicationGraph::InitClassReplicationInfo(FClassReplicationInfo& Info, const UClass* Class, bool bSpatialize) const
+{
+	const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+	if (ActorCDO == nullptr) return;
+
+	if (bSpatialize)
+	{
+		Info.SetCullDistanceSquared(ActorCDO->NetCullDistanceSquared);
+	}
+
+	Info.ReplicationPeriodFrame = GetReplicationPeriodFrame(ActorCDO->NetUpdateFrequency);
+}
+
+uint8 UAuraReplicationGraph::GetReplicationPeriodFrame(float NetUpdateFrequency) const
+{
+	if (NetDriver == nullptr || NetUpdateFrequency <= 0.0f) return 1;
+
+	return static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(NetDriver->NetServerMaxTickRate / NetUpdateFrequency), 1, MAX_uint8));
+}
+
+void UAuraReplicationGraphNode_AlwaysRelevant_ForConnection::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	Super::GatherActorListsForConnection(Params);
+
+	OwnerActorList.Reset();
+
+	const APlayerController* PlayerController = Params.ConnectionManager.NetConnection ? Params.ConnectionManager.NetConnection->PlayerController : nullptr;
+	if (PlayerController == nullptr) return;
+
+	if (APawn* Pawn = PlayerController->GetPawn(); IsValid(Pawn) && Pawn != PlayerController->GetViewTarget())
+	{
+		OwnerActorList.Add(Pawn);
+	}
+
+	/** The owner is checked on every gather, so an actor handed over to another player follows its new owner. */
+	if (const UAuraReplicationGraph* ReplicationGraph = GetTypedOuter<UAuraReplicationGraph>())
+	{
+		for (AActor* Actor : ReplicationGraph->GetOwnerOnlyActors())
+		{
+			if (IsValid(Actor) && Actor->GetNetConnection() == Params.ConnectionManager.NetConnection)
+			{
+				OwnerActorList.Add(Actor);
+			}
+		}
+	}
+
+	if (OwnerActorList.Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(OwnerActorList);
+	}
+}
@@ -6,10 +6,13 @@
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AuraGameplayTags.h"
 #include "EnhancedInputSubsystems.h"
+#include "NavigationData.h"
 #include "NavigationPath.h"
 #include "NavigationSystem.h"
+#include "NavFilters/NavigationQueryFilter.h"
 #include "NiagaraFunctionLibrary.h"
 #include "AbilitySystem/AuraAbilitySystemComponent.h"
+#include "Aura/Aura.h"
 #include "Actor/MagicCircle.h"
 #include "Components/DecalComponent.h"
 #include "Components/SplineComponent.h"
@@ -18,6 +21,15 @@
 #include "Interaction/EnemyInterface.h"
 #include "UI/Widget/DamageTextComponent.h"
 
+DECLARE_CYCLE_STAT(TEXT("Request Click-To-Move Path"), STAT_AuraRequestClickToMovePath, STATGROUP_Aura);
+DECLARE_CYCLE_STAT(TEXT("Follow Click-To-Move Path"), STAT_AuraFollowClickToMovePath, STATGROUP_Aura);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Click-To-Move Path Latency (ms)"), STAT_AuraClickToMovePathLatency, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cursor Traces"), STAT_AuraCursorTraces, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cursor Traces Skipped"), STAT_AuraCursorTracesSkipped, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Damage Texts Pooled"), STAT_AuraDamageTextsPooled, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Texts Allocated"), STAT_AuraDamageTextsAllocated, STATGROUP_Aura);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Texts Reused"), STAT_AuraDamageTextsReused, STATGROUP_Aura);
+
 AAuraPlayerController::AAuraPlayerController()
 {
 	bReplicates = true;
@@ -33,18 +45,64 @@ void AAuraPlayerController::PlayerTick(float DeltaTime)
 	UpdateMagicCircleLocation();
 }
 
-void AAuraPlayerController::ShowDamageNumber_Implementation(float DamageAmount, ACharacter* TargetCharacter, bool bBlockedHit, bool bCriticalHit)
+void AAuraPlayerController::ClientShowDamageNumbers_Implementation(const TArray<FAuraDamageNumber>& DamageNumbers)
+{
+	for (const FAuraDamageNumber& DamageNumber : DamageNumbers)
+	{
+		/** A target destroyed while the RPC was on its way comes through as `nullptr` and gets skipped there. */
+		ShowDamageNumber(DamageNumber.Damage, DamageNumber.TargetCharacter, DamageNumber.bBlockedHit, DamageNumber.bCriticalHit, DamageNumber.HitCount);
+	}
+}
+
+void AAuraPlayerController::ShowDamageNumber(float DamageAmount, ACharacter* TargetCharacter, bool bBlockedHit, bool bCriticalHit, int32 HitCount)
 {
 	if (IsValid(TargetCharacter) && DamageTextComponentClass && IsLocalController())
 	{
-		UDamageTextComponent* DamageText = NewObject<UDamageTextComponent>(TargetCharacter, DamageTextComponentClass);
-		DamageText->RegisterComponent();
+		UDamageTextComponent* DamageText = AcquireDamageTextComponent();
+
+		/**
+		 * Start from the class default relative transform, then attach & detach to place it (in world space)
+		 * relative to the target, same as a freshly created component would be.
+		 */
+		DamageText->SetRelativeTransform(DamageTextComponentClass->GetDefaultObject<UDamageTextComponent>()->GetRelativeTransform());
 		DamageText->AttachToComponent(TargetCharacter->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
 		DamageText->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
-		DamageText->SetDamageText(DamageAmount, bBlockedHit, bCriticalHit);
+		DamageText->ShowDamageText(DamageAmount, bBlockedHit, bCriticalHit, HitCount);
 	}
 }
 
+UDamageTextComponent* AAuraPlayerController::AcquireDamageTextComponent()
+{
+	/** Drop the ones which were destroyed by something else, if any. */
+	if (DamageTextComponents.RemoveAll([](const UDamageTextComponent* DamageText) { return !IsValid(DamageText); }) > 0)
+	{
+		NextDamageTextIndex = 0;
+	}
+
+	const int32 Index = NextDamageTextIndex;
+	UDamageTextComponent* DamageText = DamageTextComponents.IsValidIndex(Index) ? DamageTextComponents[Index].Get() : nullptr;
+
+	const bool bCanAllocate = DamageTextComponents.Num() < FMath::Max(MaxDamageTextComponents, 1);
+	if (DamageText == nullptr || (DamageText->IsShowingDamageText() && bCanAllocate))
+	{
+		DamageText = NewObject<UDamageTextComponent>(this, DamageTextComponentClass);
+		DamageText->SetPooled(true);
+		DamageText->RegisterComponent();
+		DamageTextComponents.Insert(DamageText, Index);
+
+		INC_DWORD_STAT(STAT_AuraDamageTextsAllocated);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_AuraDamageTextsReused);
+	}
+
+	SET_DWORD_STAT(STAT_AuraDamageTextsPooled, DamageTextComponents.Num());
+
+	NextDamageTextIndex = (Index + 1) % DamageTextComponents.Num();
+	return DamageText;
+}
+
 void AAuraPlayerController::ShowMagicCircle(UMaterialInterface* DecalMaterial)
 {
 	if (!IsValid(MagicCircle))
@@ -157,8 +215,12 @@ void AAuraPlayerController::CursorTrace()
 		return;
 	}
 
-	// Detect the actor under cursor.
-	GetHitResultUnderCursor(ECC_Visibility, false, CursorHit);
+	// Detect the actor under cursor, nothing to update if the cached hit is still used.
+	bool bUpdated = false;
+	const FHitResult& VisibilityHit = GetCachedHitResultUnderCursor(ECC_Visibility, true, &bUpdated);
+	if (!bUpdated) return;
+
+	CursorHit = VisibilityHit;
 
 	// Return early if there's no blocking hit detected.
 	if (!CursorHit.bBlockingHit) return;
@@ -174,6 +236,59 @@ void AAuraPlayerController::CursorTrace()
 	}
 }
 
+const FHitResult& AAuraPlayerController::GetCachedHitResultUnderCursor(ECollisionChannel TraceChannel, bool bThrottle, bool* bOutUpdated)
+{
+	if (bOutUpdated) *bOutUpdated = false;
+
+	FCursorTraceCache& Cache = CursorTraceCaches.FindOrAdd(TraceChannel);
+
+	float MouseX = 0.0f;
+	float MouseY = 0.0f;
+	if (!GetMousePosition(MouseX, MouseY) || PlayerCameraManager == nullptr)
+	{
+		/** Same as `GetHitResultUnderCursor()`, there's no hit without a mouse. */
+		if (bOutUpdated) *bOutUpdated = Cache.bValid || Cache.Hit.bBlockingHit;
+		Cache.Hit = FHitResult();
+		Cache.bValid = false;
+		return Cache.Hit;
+	}
+
+	const FVector2D MousePosition(MouseX, MouseY);
+	const FVector CameraLocation = PlayerCameraManager->GetCameraLocation();
+	const FRotator CameraRotation = PlayerCameraManager->GetCameraRotation();
+	const float CameraFOV = PlayerCameraManager->GetFOVAngle();
+
+	const double Now = GetWorld()->GetRealTimeSeconds();
+	const double TimeSinceTrace = Now - Cache.TraceTime;
+
+	const bool bViewChanged = !Cache.bValid
+		|| !Cache.MousePosition.Equals(MousePosition)
+		|| !Cache.CameraLocation.Equals(CameraLocation)
+		|| !Cache.CameraRotation.Equals(CameraRotation)
+		|| Cache.CameraFOV != CameraFOV;
+	const bool bStale = TimeSinceTrace >= CursorTraceMaxStaleTime;
+	const bool bRateLimited = Cache.bValid && bThrottle && CursorTraceMaxRate > 0.0f && TimeSinceTrace < 1.0 / CursorTraceMaxRate;
+
+	if ((!bViewChanged && !bStale) || bRateLimited)
+	{
+		INC_DWORD_STAT(STAT_AuraCursorTracesSkipped);
+		return Cache.Hit;
+	}
+
+	GetHitResultAtScreenPosition(MousePosition, TraceChannel, false, Cache.Hit);
+	INC_DWORD_STAT(STAT_AuraCursorTraces);
+
+	Cache.MousePosition = MousePosition;
+	Cache.CameraLocation = CameraLocation;
+	Cache.CameraRotation = CameraRotation;
+	Cache.CameraFOV = CameraFOV;
+	Cache.TraceTime = Now;
+	Cache.bValid = true;
+
+	if (bOutUpdated) *bOutUpdated = true;
+	return Cache.Hit;
+}
+
 void AAuraPlayerController::AbilityInputTagPressed(FGameplayTag InputTag)
 {
 	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputPressed))
@@ -190,6 +305,9 @@ void AAuraPlayerController::AbilityInputTagPressed(FGameplayTag InputTag)
 		// We should not be auto-running because it's not clear yet whether this is a short press.
 		// If it is short press, then we can auto-run but here we don't know yet until we release this LMB input.
 		bAutoRunning = false;
+
+		// The path requested for the previous click is stale now.
+		CancelPendingPathRequest();
 	}
 	if (GetASC()) GetASC()->AbilityInputTagPressed(InputTag);
 }
@@ -219,34 +337,7 @@ void AAuraPlayerController::AbilityInputTagReleased(FGameplayTag InputTag)
 		if (FollowTime <= ShortPressThreshold && ControlledPawn)
 		{
 			// Create a navigation path, i.e. a set of points to follow.
-			if (UNavigationPath* NavPath = UNavigationSystemV1::FindPathToLocationSynchronously(this, ControlledPawn->GetActorLocation(), CachedDestination))
-			{
-				Spline->ClearSplinePoints();
-				for (const FVector& PointLoc : NavPath->PathPoints)
-				{
-					Spline->AddSplinePoint(PointLoc, ESplineCoordinateSpace::World);
-				}
-
-				if (NavPath->PathPoints.Num() > 0)
-				{
-					// Override the destination to last point of `NavPath`.
-					// This will avoid the issue of un-reachable locations where "NavMeshBoundsVolume" is not covered on the game map.
-					CachedDestination = NavPath->PathPoints[NavPath->PathPoints.Num() - 1];
-
-					// Set the auto-running since we have navigation points ready.
-					bAutoRunning = true;
-
-					// Only play the Niagara system if we are NOT blocking the input pressed.
-					if (GetASC() && !GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputPressed))
-					{
-						UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-							this,
-							ClickNiagaraSystem,
-							CachedDestination
-						);
-					}
-				}
-			}
+			RequestPathToCachedDestination(ControlledPawn->GetActorLocation());
 		}
 
 		// Reset total pressed time for the LMB input.
@@ -257,6 +348,101 @@ void AAuraPlayerController::AbilityInputTagReleased(FGameplayTag InputTag)
 	}
 }
 
+void AAuraPlayerController::RequestPathToCachedDestination(const FVector& PathStart)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraRequestClickToMovePath);
+
+	CancelPendingPathRequest();
+
+	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (NavSystem == nullptr) return;
+
+	if (!bUseAsyncPathfinding)
+	{
+		if (UNavigationPath* NavPath = UNavigationSystemV1::FindPathToLocationSynchronously(this, PathStart, CachedDestination))
+		{
+			FollowPathPoints(NavPath->PathPoints);
+		}
+		return;
+	}
+
+	/** Same navigation data & filter as `FindPathToLocationSynchronously()` uses with this controller as the context. */
+	const ANavigationData* NavData = NavSystem->GetDefaultNavDataInstance(FNavigationSystem::DontCreate);
+	if (NavData == nullptr) return;
+
+	const FPathFindingQuery Query(this, *NavData, PathStart, CachedDestination, UNavigationQueryFilter::GetQueryFilter(*NavData, this, nullptr));
+
+	PendingPathRequestTime = FPlatformTime::Seconds();
+	PendingPathQueryID = NavSystem->FindPathAsync(
+		NavData->GetConfig(),
+		Query,
+		FNavPathQueryDelegate::CreateUObject(this, &AAuraPlayerController::OnAsyncPathFound)
+	);
+}
+
+void AAuraPlayerController::CancelPendingPathRequest()
+{
+	if (PendingPathQueryID == 0) return;
+
+	if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSystem->AbortAsyncFindPathRequest(PendingPathQueryID);
+	}
+	PendingPathQueryID = 0;
+}
+
+void AAuraPlayerController::OnAsyncPathFound(uint32 QueryID, ENavigationQueryResult::Type Result, FNavPathSharedPtr NavPath)
+{
+	/** Ignore the results of the requests which were cancelled by a newer click. */
+	if (QueryID != PendingPathQueryID) return;
+	PendingPathQueryID = 0;
+
+	SET_FLOAT_STAT(STAT_AuraClickToMovePathLatency, (FPlatformTime::Seconds() - PendingPathRequestTime) * 1000.0);
+
+	if (Result != ENavigationQueryResult::Success || !NavPath.IsValid()) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_AuraFollowClickToMovePath);
+
+	TArray<FVector> PathPoints;
+	PathPoints.Reserve(NavPath->GetPathPoints().Num());
+	for (const FNavPathPoint& PathPoint : NavPath->GetPathPoints())
+	{
+		PathPoints.Add(PathPoint.Location);
+	}
+
+	FollowPathPoints(PathPoints);
+}
+
+void AAuraPlayerController::FollowPathPoints(const TArray<FVector>& PathPoints)
+{
+	Spline->ClearSplinePoints();
+	for (const FVector& PointLoc : PathPoints)
+	{
+		Spline->AddSplinePoint(PointLoc, ESplineCoordinateSpace::World);
+	}
+	SplinePathFollower.Reset();
+
+	if (PathPoints.Num() > 0)
+	{
+		// Override the destination to last point of the path.
+		// This will avoid the issue of un-reachable locations where "NavMeshBoundsVolume" is not covered on the game map.
+		CachedDestination = PathPoints[PathPoints.Num() - 1];
+
+		// Set the auto-running since we have navigation points ready.
+		bAutoRunning = true;
+
+		// Only play the Niagara system if we are NOT blocking the input pressed.
+		if (GetASC() && !GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputPressed))
+		{
+			UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+				this,
+				ClickNiagaraSystem,
+				CachedDestination
+			);
+		}
+	}
+}
+
 void AAuraPlayerController::AbilityInputTagHeld(FGameplayTag InputTag)
 {
 	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputHeld))
@@ -328,13 +514,12 @@ void AAuraPlayerController::AutoRun()
 
 	if (APawn* ControlledPawn = GetPawn<APawn>())
 	{
-		// Find the location on the spline i.e. closest to the Pawn.
+		// Find the location on the spline i.e. closest to the Pawn & the direction on the spline at that location.
 		// Because our Pawn may not be exactly on the spline.
-		const FVector LocationOnSpline = Spline->FindLocationClosestToWorldLocation(ControlledPawn->GetActorLocation(), ESplineCoordinateSpace::World);
-
-		// Find the direction on the spline that corresponds to this location.
-		// Instead of `LocationOnSpline` we can also pass `ControlledPawn->GetActorLocation()`.
-		const FVector Direction = Spline->FindDirectionClosestToWorldLocation(LocationOnSpline, ESplineCoordinateSpace::World);
+		// The follower only searches ahead of where the Pawn was on the spline instead of the whole spline.
+		FVector LocationOnSpline;
+		FVector Direction;
+		SplinePathFollower.Update(*Spline, ControlledPawn->GetActorLocation(), LocationOnSpline, Direction);
 
 		// Move towards the destination.
 		ControlledPawn->AddMovementInput(Direction);
@@ -0,0 +1,82 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AI/AuraAISignificanceSubsystem.h"
+#include "Character/AuraEnemy.h"
+#include "GameFramework/DefaultPawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Interaction/EnemyInterface.h"
+#include "Tests/AuraTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraAISignificanceTest, "Aura.AI.Significance",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraAISignificanceTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumEnemiesPerRun[] = { 100, 1000 };
+
+	/** Enough time for the subsystem to update on every tick. */
+	static constexpr float TickDeltaTime = 1.0f;
+	static constexpr int32 NumUpdates = 10;
+
+	for (const int32 NumEnemies : NumEnemiesPerRun)
+	{
+		FAuraTestWorld TestWorld;
+
+		APlayerController* PlayerController = TestWorld.World->SpawnActor<APlayerController>();
+		PlayerController->Possess(TestWorld.World->SpawnActor<ADefaultPawn>(FVector::ZeroVector, FRotator::ZeroRotator));
+
+		UAuraAISignificanceSubsystem* SignificanceSubsystem = TestWorld.World->GetSubsystem<UAuraAISignificanceSubsystem>();
+
+		// Spread along a line from right next to the player to well beyond the `Low` bucket.
+		TArray<AAuraEnemy*> Enemies;
+		for (int32 Index = 0; Index < NumEnemies; ++Index)
+		{
+			AAuraEnemy* Enemy = TestWorld.SpawnCombatant<AAuraEnemy>(FVector(100.0f + Index * 10000.0f / NumEnemies, 0.0f, 0.0f));
+			SignificanceSubsystem->RegisterEnemy(Enemy);
+			Enemies.Add(Enemy);
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Update = 0; Update < NumUpdates; ++Update)
+		{
+			SignificanceSubsystem->Tick(TickDeltaTime);
+		}
+		const double UpdateSeconds = (FPlatformTime::Seconds() - StartTime) / NumUpdates;
+
+		TestEqual(TEXT("Nearest enemy is High"), Enemies[0]->GetAISignificance(), EAuraAISignificance::High);
+		TestEqual(TEXT("Farthest enemy is Dormant"), Enemies.Last()->GetAISignificance(), EAuraAISignificance::Dormant);
+
+		// Farther enemies are never more significant than nearer ones.
+		int32 NumOutOfOrder = 0;
+		int32 BucketCounts[static_cast<uint8>(EAuraAISignificance::MAX)] = {};
+		for (int32 Index = 0; Index < Enemies.Num(); ++Index)
+		{
+			++BucketCounts[static_cast<uint8>(Enemies[Index]->GetAISignificance())];
+			if (Index > 0 && Enemies[Index]->GetAISignificance() < Enemies[Index - 1]->GetAISignificance()) ++NumOutOfOrder;
+		}
+		TestEqual(TEXT("Buckets follow the distance to the player"), NumOutOfOrder, 0);
+
+		AddInfo(FString::Printf(TEXT("%d enemies: %.3f ms per significance update (High %d, Medium %d, Low %d, Dormant %d)"),
+			NumEnemies, UpdateSeconds * 1000.0,
+			BucketCounts[static_cast<uint8>(EAuraAISignificance::High)], BucketCounts[static_cast<uint8>(EAuraAISignificance::Medium)],
+			BucketCounts[static_cast<uint8>(EAuraAISignificance::Low)], BucketCounts[static_cast<uint8>(EAuraAISignificance::Dormant)]));
+
+		// Aggro wakes a dormant enemy up all the way, not only its net dormancy, & restores the class' cull distance.
+		AAuraEnemy* DormantEnemy = Enemies.Last();
+		TestTrue(TEXT("Dormant enemy is net dormant"), DormantEnemy->NetDormancy == DORM_DormantAll);
+		TestTrue(TEXT("Dormant enemy has a shorter cull distance"), DormantEnemy->NetCullDistanceSquared < GetDefault<AAuraEnemy>()->NetCullDistanceSquared);
+
+		IEnemyInterface::Execute_SetCombatTarget(DormantEnemy, PlayerController->GetPawn());
+		TestEqual(TEXT("Aggro wakes the enemy up"), DormantEnemy->GetAISignificance(), EAuraAISignificance::High);
+		TestTrue(TEXT("Aggro wakes the net dormancy up"), DormantEnemy->NetDormancy == DORM_Awake);
+		TestEqual(TEXT("Aggro restores the cull distance"), DormantEnemy->NetCullDistanceSquared, GetDefault<AAuraEnemy>()->NetCullDistanceSquared);
+	}
+
+	return true;
+}
+
+#endif
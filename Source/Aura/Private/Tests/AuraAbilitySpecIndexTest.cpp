@@ -0,0 +1,121 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystem/Abilities/AuraGameplayAbility.h"
+#include "AbilitySystem/AuraAbilitySystemComponent.h"
+#include "AuraGameplayTags.h"
+#include "Tests/AuraTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraAbilitySpecIndexTest, "Aura.AbilitySystem.AbilitySpecIndex",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraAbilitySpecIndexTest::RunTest(const FString& Parameters)
+{
+	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+
+	FAuraTestWorld TestWorld;
+	AActor* Owner = TestWorld.World->SpawnActor<AActor>();
+
+	UAuraAbilitySystemComponent* AbilitySystemComponent = NewObject<UAuraAbilitySystemComponent>(Owner);
+	AbilitySystemComponent->RegisterComponent();
+	AbilitySystemComponent->InitAbilityActorInfo(Owner, Owner);
+
+	FGameplayAbilitySpec LMBSpec(UAuraGameplayAbility::StaticClass(), 1);
+	LMBSpec.DynamicAbilityTags.AddTag(GameplayTags.InputTag_LMB);
+	const FGameplayAbilitySpecHandle LMBHandle = AbilitySystemComponent->GiveAbility(LMBSpec);
+
+	FGameplayAbilitySpec UnslottedSpec(UAuraGameplayAbility::StaticClass(), 1);
+	AbilitySystemComponent->GiveAbility(UnslottedSpec);
+
+	// Given abilities are picked up by the lazy rebuild.
+	const FGameplayAbilitySpec* SpecWithLMB = AbilitySystemComponent->GetSpecWithSlot(GameplayTags.InputTag_LMB);
+	if (!TestNotNull(TEXT("Spec in the LMB slot"), SpecWithLMB)) return false;
+	TestTrue(TEXT("LMB slot holds the slotted spec"), SpecWithLMB->Handle == LMBHandle);
+	TestTrue(TEXT("RMB slot is empty"), AbilitySystemComponent->SlotIsEmpty(GameplayTags.InputTag_RMB));
+	TestEqual(TEXT("Cached input tag"), AbilitySystemComponent->GetInputTagFromSpec(*SpecWithLMB), GameplayTags.InputTag_LMB);
+
+	// Moving the spec to another slot patches only its entry.
+	AbilitySystemComponent->AssignSlotToAbility(*AbilitySystemComponent->FindAbilitySpecFromHandle(LMBHandle), GameplayTags.InputTag_RMB);
+	TestTrue(TEXT("LMB slot is empty after the move"), AbilitySystemComponent->SlotIsEmpty(GameplayTags.InputTag_LMB));
+	const FGameplayAbilitySpec* SpecWithRMB = AbilitySystemComponent->GetSpecWithSlot(GameplayTags.InputTag_RMB);
+	if (!TestNotNull(TEXT("Spec in the RMB slot"), SpecWithRMB)) return false;
+	TestTrue(TEXT("RMB slot holds the moved spec"), SpecWithRMB->Handle == LMBHandle);
+
+	// Removed abilities drop out of the index.
+	AbilitySystemComponent->ClearAbility(LMBHandle);
+	TestNull(TEXT("Spec in the RMB slot after clearing the ability"), AbilitySystemComponent->GetSpecWithSlot(GameplayTags.InputTag_RMB));
+	TestTrue(TEXT("RMB slot is empty after clearing the ability"), AbilitySystemComponent->SlotIsEmpty(GameplayTags.InputTag_RMB));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraAbilitySpecIndexScalingTest, "Aura.AbilitySystem.AbilitySpecIndexScaling",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraAbilitySpecIndexScalingTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumAbilitiesPerRun[] = { 10, 500 };
+	static constexpr int32 NumEquips = 8;
+
+	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+
+	TArray<uint32, TInlineAllocator<2>> SpecsScannedPerRun;
+	for (const int32 NumAbilities : NumAbilitiesPerRun)
+	{
+		FAuraTestWorld TestWorld;
+		AActor* Owner = TestWorld.World->SpawnActor<AActor>();
+
+		UAuraAbilitySystemComponent* AbilitySystemComponent = NewObject<UAuraAbilitySystemComponent>(Owner);
+		AbilitySystemComponent->RegisterComponent();
+		AbilitySystemComponent->InitAbilityActorInfo(Owner, Owner);
+
+		for (int32 Index = 0; Index < NumAbilities; ++Index)
+		{
+			FGameplayAbilitySpec AbilitySpec(UAuraGameplayAbility::StaticClass(), 1);
+			AbilitySpec.DynamicAbilityTags.AddTag(GameplayTags.Abilities_Status_Eligible);
+			AbilitySystemComponent->GiveAbility(AbilitySpec);
+		}
+
+		// The one rebuild after giving the abilities, which does scale with their number.
+		AbilitySystemComponent->SlotIsEmpty(GameplayTags.InputTag_1);
+		const uint32 SpecsScannedBefore = AbilitySystemComponent->GetNumSpecsScannedByIndex();
+
+		// Spend a spell point on & equip several abilities in turn into the same slot, as the spell menu would.
+		for (int32 Index = 0; Index < NumEquips; ++Index)
+		{
+			FGameplayAbilitySpec& AbilitySpec = AbilitySystemComponent->GetActivatableAbilities()[Index];
+			AbilitySystemComponent->SetAbilityStatus(AbilitySpec, GameplayTags.Abilities_Status_Unlocked);
+
+			if (FGameplayAbilitySpec* SpecWithSlot = AbilitySystemComponent->GetSpecWithSlot(GameplayTags.InputTag_1))
+			{
+				AbilitySystemComponent->ClearSlot(SpecWithSlot);
+				AbilitySystemComponent->SetAbilityStatus(*SpecWithSlot, GameplayTags.Abilities_Status_Unlocked);
+			}
+
+			AbilitySystemComponent->AssignSlotToAbility(AbilitySpec, GameplayTags.InputTag_1);
+			AbilitySystemComponent->SetAbilityStatus(AbilitySpec, GameplayTags.Abilities_Status_Equipped);
+		}
+
+		const FGameplayAbilitySpec* SpecWithSlot = AbilitySystemComponent->GetSpecWithSlot(GameplayTags.InputTag_1);
+		if (!TestNotNull(TEXT("Spec in the slot"), SpecWithSlot)) return false;
+		TestTrue(TEXT("Last equipped spec holds the slot"), SpecWithSlot->Handle == AbilitySystemComponent->GetActivatableAbilities()[NumEquips - 1].Handle);
+		TestEqual(TEXT("Equipped status"), AbilitySystemComponent->GetStatusFromSpec(*SpecWithSlot), GameplayTags.Abilities_Status_Equipped);
+		TestEqual(TEXT("Previously equipped spec is unlocked"),
+			AbilitySystemComponent->GetStatusFromSpec(AbilitySystemComponent->GetActivatableAbilities()[0]), GameplayTags.Abilities_Status_Unlocked);
+
+		const uint32 SpecsScanned = AbilitySystemComponent->GetNumSpecsScannedByIndex() - SpecsScannedBefore;
+		SpecsScannedPerRun.Add(SpecsScanned);
+
+		AddInfo(FString::Printf(TEXT("%d abilities: %u specs scanned for %d spends & equips (a linear search per lookup would visit up to %d)"),
+			NumAbilities, SpecsScanned, NumEquips, NumEquips * 3 * NumAbilities));
+	}
+
+	TestEqual(TEXT("Specs scanned per spend & equip don't grow with the number of abilities"), SpecsScannedPerRun[1], SpecsScannedPerRun[0]);
+
+	return true;
+}
+
+#endif
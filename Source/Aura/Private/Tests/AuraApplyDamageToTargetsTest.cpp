@@ -0,0 +1,88 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystem/AuraAbilitySystemComponent.h"
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "AuraAbilityTypes.h"
+#include "AuraGameplayTags.h"
+#include "GameplayEffect.h"
+#include "Tests/AuraTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraApplyDamageToTargetsTest, "Aura.AbilitySystem.ApplyDamageToTargets",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraApplyDamageToTargetsTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumTargetsPerRun[] = { 1, 10, 100 };
+	static constexpr int32 NumIterations = 100;
+
+	FAuraTestWorld TestWorld;
+
+	auto SpawnWithAbilitySystem = [&TestWorld](const FVector& Location)
+	{
+		AActor* Actor = TestWorld.World->SpawnActor<AActor>(Location, FRotator::ZeroRotator);
+		UAuraAbilitySystemComponent* AbilitySystemComponent = NewObject<UAuraAbilitySystemComponent>(Actor);
+		AbilitySystemComponent->RegisterComponent();
+		AbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+		return AbilitySystemComponent;
+	};
+
+	UAuraAbilitySystemComponent* SourceAbilitySystemComponent = SpawnWithAbilitySystem(FVector::ZeroVector);
+
+	int32 NumApplied = 0;
+	SourceAbilitySystemComponent->OnGameplayEffectAppliedDelegateToTarget.AddLambda(
+		[&NumApplied](UAbilitySystemComponent*, const FGameplayEffectSpec&, FActiveGameplayEffectHandle) { ++NumApplied; });
+
+	// An empty instant effect, so the numbers are about building & applying the specs rather than the damage itself.
+	FDamageEffectParams DamageEffectParams;
+	DamageEffectParams.WorldContextObject = SourceAbilitySystemComponent->GetAvatarActor();
+	DamageEffectParams.DamageGameplayEffectClass = UGameplayEffect::StaticClass();
+	DamageEffectParams.SourceAbilitySystemComponent = SourceAbilitySystemComponent;
+	DamageEffectParams.BaseDamage = 10.0f;
+	DamageEffectParams.AbilityLevel = 1.0f;
+	DamageEffectParams.DamageType = FAuraGameplayTags::Get().Damage_Lightning;
+
+	TArray<UAbilitySystemComponent*> TargetAbilitySystemComponents;
+	for (const int32 NumTargets : NumTargetsPerRun)
+	{
+		while (TargetAbilitySystemComponents.Num() < NumTargets)
+		{
+			TargetAbilitySystemComponents.Add(SpawnWithAbilitySystem(FVector(500.0f, TargetAbilitySystemComponents.Num() * 50.0f, 0.0f)));
+		}
+
+		// One spec & context per target, like the Blueprint's `ApplyDamageEffect()` for each of them.
+		NumApplied = 0;
+		const double PerTargetStartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (UAbilitySystemComponent* TargetAbilitySystemComponent : TargetAbilitySystemComponents)
+			{
+				DamageEffectParams.TargetAbilitySystemComponent = TargetAbilitySystemComponent;
+				UAuraAbilitySystemLibrary::ApplyDamageEffect(DamageEffectParams);
+			}
+		}
+		const double PerTargetSeconds = (FPlatformTime::Seconds() - PerTargetStartTime) / NumIterations;
+		TestEqual(TEXT("Effects applied one target at a time"), NumApplied, NumTargets * NumIterations);
+
+		// One spec for the whole batch, copied for each target.
+		NumApplied = 0;
+		DamageEffectParams.TargetAbilitySystemComponent = nullptr;
+		const double BatchStartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			UAuraAbilitySystemLibrary::ApplyDamageEffectToTargets(DamageEffectParams, TargetAbilitySystemComponents);
+		}
+		const double BatchSeconds = (FPlatformTime::Seconds() - BatchStartTime) / NumIterations;
+		TestEqual(TEXT("Effects applied in a batch"), NumApplied, NumTargets * NumIterations);
+
+		AddInfo(FString::Printf(TEXT("%d targets: %.4f ms one at a time, %.4f ms batched"),
+			NumTargets, PerTargetSeconds * 1000.0, BatchSeconds * 1000.0));
+	}
+
+	return true;
+}
+
+#endif
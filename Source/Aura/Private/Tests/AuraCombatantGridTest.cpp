@@ -0,0 +1,95 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Character/AuraEnemy.h"
+#include "Engine/OverlapResult.h"
+#include "Game/AuraCombatantGridSubsystem.h"
+#include "Interaction/CombatInterface.h"
+#include "Tests/AuraTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraCombatantGridTest, "Aura.Game.CombatantGrid",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraCombatantGridTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumCombatantsPerRun[] = { 50, 500, 5000 };
+	static constexpr int32 NumQueries = 200;
+	static constexpr float QueryRadius = 500.0f;
+
+	/** Room per combatant, so the crowd is equally dense in every run & only its size changes. */
+	static constexpr float AreaPerCombatant = 400.0f * 400.0f;
+
+	for (const int32 NumCombatants : NumCombatantsPerRun)
+	{
+		FAuraTestWorld TestWorld;
+
+		const float HalfExtent = 0.5f * FMath::Sqrt(NumCombatants * AreaPerCombatant);
+		FRandomStream RandomStream(NumCombatants);
+		for (int32 Index = 0; Index < NumCombatants; ++Index)
+		{
+			const FVector Location(RandomStream.FRandRange(-HalfExtent, HalfExtent), RandomStream.FRandRange(-HalfExtent, HalfExtent), 0.0f);
+			TestWorld.SpawnCombatant<AAuraEnemy>(Location);
+		}
+
+		TArray<FVector> QueryOrigins;
+		for (int32 Index = 0; Index < NumQueries; ++Index)
+		{
+			QueryOrigins.Emplace(RandomStream.FRandRange(-HalfExtent, HalfExtent), RandomStream.FRandRange(-HalfExtent, HalfExtent), 0.0f);
+		}
+
+		const UAuraCombatantGridSubsystem* CombatantGrid = TestWorld.World->GetSubsystem<UAuraCombatantGridSubsystem>();
+		const TArray<AActor*> ActorsToIgnore;
+
+		TArray<TArray<AActor*>> GridResults;
+		GridResults.SetNum(NumQueries);
+		const double GridStartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumQueries; ++Index)
+		{
+			CombatantGrid->GetLiveCombatantsWithinRadius(GridResults[Index], ActorsToIgnore, QueryRadius, QueryOrigins[Index]);
+		}
+		const double GridSeconds = FPlatformTime::Seconds() - GridStartTime;
+
+		// What `UAuraAbilitySystemLibrary::GetLivePlayersWithinRadius()` did before the grid.
+		TArray<TArray<AActor*>> OverlapResults;
+		OverlapResults.SetNum(NumQueries);
+		const double OverlapStartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumQueries; ++Index)
+		{
+			FCollisionQueryParams SphereParams;
+			SphereParams.AddIgnoredActors(ActorsToIgnore);
+
+			TArray<FOverlapResult> Overlaps;
+			TestWorld.World->OverlapMultiByObjectType(Overlaps, QueryOrigins[Index], FQuat::Identity,
+				FCollisionObjectQueryParams(FCollisionObjectQueryParams::InitType::AllDynamicObjects), FCollisionShape::MakeSphere(QueryRadius), SphereParams);
+			for (const FOverlapResult& Overlap : Overlaps)
+			{
+				if (Overlap.GetActor()->Implements<UCombatInterface>() && !ICombatInterface::Execute_IsDead(Overlap.GetActor()))
+				{
+					OverlapResults[Index].AddUnique(ICombatInterface::Execute_GetAvatar(Overlap.GetActor()));
+				}
+			}
+		}
+		const double OverlapSeconds = FPlatformTime::Seconds() - OverlapStartTime;
+
+		int32 NumMismatchedQueries = 0;
+		int32 NumFound = 0;
+		for (int32 Index = 0; Index < NumQueries; ++Index)
+		{
+			GridResults[Index].Sort();
+			OverlapResults[Index].Sort();
+			if (GridResults[Index] != OverlapResults[Index]) ++NumMismatchedQueries;
+			NumFound += GridResults[Index].Num();
+		}
+		TestEqual(TEXT("The grid finds the same combatants as the physics overlap"), NumMismatchedQueries, 0);
+
+		AddInfo(FString::Printf(TEXT("%d combatants, %d queries (%.1f found on average): grid %.3f ms, physics overlap %.3f ms"),
+			NumCombatants, NumQueries, static_cast<float>(NumFound) / NumQueries, GridSeconds * 1000.0, OverlapSeconds * 1000.0));
+	}
+
+	return true;
+}
+
+#endif
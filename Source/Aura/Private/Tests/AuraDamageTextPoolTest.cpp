@@ -0,0 +1,70 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Game/AuraDamageNumberSubsystem.h"
+#include "GameFramework/Character.h"
+#include "Player/AuraPlayerController.h"
+#include "Tests/AuraTestWorld.h"
+#include "UI/Widget/DamageTextComponent.h"
+#include "UObject/UnrealType.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraDamageTextPoolTest, "Aura.UI.DamageTextPool",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraDamageTextPoolTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumDamageNumbers = 1000;
+
+	FAuraTestWorld TestWorld;
+
+	AAuraPlayerController* PlayerController = TestWorld.World->SpawnActor<AAuraPlayerController>();
+	ACharacter* TargetCharacter = TestWorld.World->SpawnActor<ACharacter>(FVector(500.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+
+	// The damage text class is set on the Blueprint subclass, the native one does as well here.
+	FClassProperty* DamageTextClassProperty = FindFProperty<FClassProperty>(AAuraPlayerController::StaticClass(), TEXT("DamageTextComponentClass"));
+	const FIntProperty* MaxDamageTextsProperty = FindFProperty<FIntProperty>(AAuraPlayerController::StaticClass(), TEXT("MaxDamageTextComponents"));
+	if (!TestNotNull(TEXT("Damage text class property"), DamageTextClassProperty) || !TestNotNull(TEXT("Max damage texts property"), MaxDamageTextsProperty)) return false;
+
+	DamageTextClassProperty->SetObjectPropertyValue_InContainer(PlayerController, UDamageTextComponent::StaticClass());
+	const int32 MaxDamageTextComponents = MaxDamageTextsProperty->GetPropertyValue_InContainer(PlayerController);
+
+	// One damage number per call, as if every hit arrived separately. None of them finish showing in between.
+	for (int32 Index = 0; Index < NumDamageNumbers; ++Index)
+	{
+		FAuraDamageNumber DamageNumber;
+		DamageNumber.TargetCharacter = TargetCharacter;
+		DamageNumber.Damage = 10.0f + Index;
+		DamageNumber.HitCount = 1;
+		PlayerController->ClientShowDamageNumbers({ DamageNumber });
+	}
+
+	TArray<UDamageTextComponent*> DamageTexts;
+	PlayerController->GetComponents<UDamageTextComponent>(DamageTexts);
+	DamageTexts.RemoveAllSwap([](const UDamageTextComponent* DamageText) { return !IsValid(DamageText); });
+
+	TestTrue(FString::Printf(TEXT("%d live damage texts for %d damage numbers, at most %d"), DamageTexts.Num(), NumDamageNumbers, MaxDamageTextComponents),
+		DamageTexts.Num() <= MaxDamageTextComponents);
+	TestEqual(TEXT("Pool fills up while every damage text is still showing"), DamageTexts.Num(), MaxDamageTextComponents);
+
+	// Finished ones are reused before the pool grows.
+	for (UDamageTextComponent* DamageText : DamageTexts)
+	{
+		DamageText->FinishDamageText();
+	}
+	FAuraDamageNumber DamageNumber;
+	DamageNumber.TargetCharacter = TargetCharacter;
+	DamageNumber.Damage = 1.0f;
+	DamageNumber.HitCount = 1;
+	PlayerController->ClientShowDamageNumbers({ DamageNumber });
+
+	TArray<UDamageTextComponent*> DamageTextsAfterReuse;
+	PlayerController->GetComponents<UDamageTextComponent>(DamageTextsAfterReuse);
+	TestEqual(TEXT("Damage texts after reusing a finished one"), DamageTextsAfterReuse.Num(), DamageTexts.Num());
+
+	return true;
+}
+
+#endif
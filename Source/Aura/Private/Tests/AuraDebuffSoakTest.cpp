@@ -0,0 +1,107 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystem/AuraAbilitySystemComponent.h"
+#include "AbilitySystem/AuraAbilitySystemGlobals.h"
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "AbilitySystem/AuraAttributeSet.h"
+#include "AuraGameplayTags.h"
+#include "GameFramework/Character.h"
+#include "GameplayEffect.h"
+#include "Tests/AuraTestWorld.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectArray.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraDebuffSoakTest, "Aura.AbilitySystem.DebuffSoak",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraDebuffSoakTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumDebuffs = 10000;
+	static constexpr float DebuffFrequencies[] = { 0.5f, 1.0f, 1.5f, 2.0f };
+	static constexpr int32 NumFrequencies = UE_ARRAY_COUNT(DebuffFrequencies);
+
+	/** Objects created elsewhere in the process while the test runs (e.g. by the editor), none of them by the debuffs. */
+	static constexpr int32 MaxUnrelatedNewObjects = 64;
+
+	UAuraAbilitySystemGlobals* AbilitySystemGlobals = Cast<UAuraAbilitySystemGlobals>(&UAbilitySystemGlobals::Get());
+	if (!TestNotNull(TEXT("Aura ability system globals"), AbilitySystemGlobals)) return false;
+
+	FAuraTestWorld TestWorld;
+
+	auto AddAbilitySystem = [](AActor* Actor)
+	{
+		UAuraAbilitySystemComponent* AbilitySystemComponent = NewObject<UAuraAbilitySystemComponent>(Actor);
+		AbilitySystemComponent->RegisterComponent();
+		AbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+		AbilitySystemComponent->InitStats(UAuraAttributeSet::StaticClass(), nullptr);
+		return AbilitySystemComponent;
+	};
+
+	UAuraAbilitySystemComponent* SourceAbilitySystemComponent = AddAbilitySystem(TestWorld.World->SpawnActor<AActor>());
+
+	// A character target, enough health to survive every hit & its debuff.
+	UAuraAbilitySystemComponent* TargetAbilitySystemComponent = AddAbilitySystem(
+		TestWorld.World->SpawnActor<ACharacter>(FVector(500.0f, 0.0f, 0.0f), FRotator::ZeroRotator));
+	TargetAbilitySystemComponent->SetNumericAttributeBase(UAuraAttributeSet::GetMaxHealthAttribute(), 1000000.0f);
+	TargetAbilitySystemComponent->SetNumericAttributeBase(UAuraAttributeSet::GetHealthAttribute(), 1000000.0f);
+
+	// One point of incoming damage, its context carries the debuff like the one `UExecCalc_Damage` rolls.
+	TStrongObjectPtr<UGameplayEffect> DamageEffect(NewObject<UGameplayEffect>(GetTransientPackage()));
+	FGameplayModifierInfo& ModifierInfo = DamageEffect->Modifiers.AddDefaulted_GetRef();
+	ModifierInfo.Attribute = UAuraAttributeSet::GetIncomingDamageAttribute();
+	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
+	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(1.0f));
+
+	TArray<FGameplayTag> DamageTypes;
+	FAuraGameplayTags::Get().DamageTypesToDebuffs.GenerateKeyArray(DamageTypes);
+	const int32 NumDebuffEffectsBefore = AbilitySystemGlobals->GetNumDebuffEffects();
+
+	auto ApplyDebuff = [&](int32 Index)
+	{
+		FGameplayEffectContextHandle EffectContextHandle = SourceAbilitySystemComponent->MakeEffectContext();
+		UAuraAbilitySystemLibrary::SetIsSuccessfulDebuff(EffectContextHandle, true);
+		UAuraAbilitySystemLibrary::SetDamageType(EffectContextHandle, DamageTypes[Index % DamageTypes.Num()]);
+		UAuraAbilitySystemLibrary::SetDebuffDamage(EffectContextHandle, 1.0f);
+		UAuraAbilitySystemLibrary::SetDebuffDuration(EffectContextHandle, 5.0f);
+		UAuraAbilitySystemLibrary::SetDebuffFrequency(EffectContextHandle, DebuffFrequencies[Index / DamageTypes.Num() % NumFrequencies]);
+
+		const FGameplayEffectSpec DamageSpec(DamageEffect.Get(), EffectContextHandle, 1.0f);
+		SourceAbilitySystemComponent->ApplyGameplayEffectSpecToTarget(DamageSpec, TargetAbilitySystemComponent);
+	};
+
+	// Every damage type & frequency once, so the measured debuffs only ever reuse the cached effects.
+	const int32 NumCombinations = DamageTypes.Num() * NumFrequencies;
+	for (int32 Index = 0; Index < NumCombinations; ++Index)
+	{
+		ApplyDebuff(Index);
+	}
+	const int32 NumDebuffEffects = AbilitySystemGlobals->GetNumDebuffEffects();
+
+	const int32 NumObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumDebuffs; ++Index)
+	{
+		ApplyDebuff(Index);
+	}
+	const double DebuffSeconds = FPlatformTime::Seconds() - StartTime;
+	const int32 NumNewObjects = GUObjectArray.GetObjectArrayNumMinusAvailable() - NumObjectsBefore;
+
+	const double GarbageCollectionStartTime = FPlatformTime::Seconds();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	const double GarbageCollectionSeconds = FPlatformTime::Seconds() - GarbageCollectionStartTime;
+
+	TestTrue(TEXT("One cached effect per damage type & frequency at most"), NumDebuffEffects - NumDebuffEffectsBefore <= NumCombinations);
+	TestEqual(TEXT("No effects cached by the repeated debuffs"), AbilitySystemGlobals->GetNumDebuffEffects(), NumDebuffEffects);
+	TestTrue(TEXT("UObject count stays bounded"), NumNewObjects <= MaxUnrelatedNewObjects);
+
+	AddInfo(FString::Printf(TEXT("%d debuffs: %.3f ms, %d cached debuff effects, %d new UObjects, %.3f ms garbage collection afterwards"),
+		NumDebuffs, DebuffSeconds * 1000.0, NumDebuffEffects, NumNewObjects, GarbageCollectionSeconds * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,162 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AuraAbilityTypes.h"
+#include "AuraGameplayTags.h"
+#include "Serialization/BitReader.h"
+#include "UObject/CoreNet.h"
+
+namespace AuraEffectContextSerializationTest
+{
+	/**
+	 * Writes `Source` & reads it back into `Target`, the way it goes over the network.
+	 * Fails unless the reading side consumes exactly the bits written.
+	 */
+	bool RoundTrip(FAuraGameplayEffectContext& Source, FAuraGameplayEffectContext& Target, int64* OutNumBits = nullptr)
+	{
+		bool bWriteSuccess = false;
+		FNetBitWriter Writer(nullptr, 0);
+		Source.NetSerialize(Writer, nullptr, bWriteSuccess);
+
+		bool bReadSuccess = false;
+		FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+		Target.NetSerialize(Reader, nullptr, bReadSuccess);
+
+		if (OutNumBits)
+		{
+			*OutNumBits = Writer.GetNumBits();
+		}
+
+		return bWriteSuccess && bReadSuccess && !Writer.IsError() && !Reader.IsError() && Reader.GetPosBits() == Writer.GetNumBits();
+	}
+
+	/**
+	 * Bits `Context` took in the format before this one, which sent the flags after their `RepBits`, full floats & vectors
+	 * and the damage type as a tag. Only for contexts without any of the base `FGameplayEffectContext` members set,
+	 * those are written the same way by both formats.
+	 */
+	int64 GetPreviousFormatNumBits(const FAuraGameplayEffectContext& Context)
+	{
+		FNetBitWriter Writer(nullptr, 0);
+
+		uint32 RepBits = 0;
+		Writer.SerializeBits(&RepBits, 16);
+
+		bool bIsBlockedHit = Context.IsBlockedHit();
+		bool bIsCriticalHit = Context.IsCriticalHit();
+		bool bIsSuccessfulDebuff = Context.IsSuccessfulDebuff();
+		float DebuffDamage = Context.GetDebuffDamage();
+		float DebuffDuration = Context.GetDebuffDuration();
+		float DebuffFrequency = Context.GetDebuffFrequency();
+		FVector DeathImpulse = Context.GetDeathImpulse();
+		FVector KnockbackForce = Context.GetKnockbackForce();
+		bool bSuccess = false;
+
+		if (bIsBlockedHit) Writer << bIsBlockedHit;
+		if (bIsCriticalHit) Writer << bIsCriticalHit;
+		if (bIsSuccessfulDebuff) Writer << bIsSuccessfulDebuff;
+		if (DebuffDamage > 0.0f) Writer << DebuffDamage;
+		if (DebuffDuration > 0.0f) Writer << DebuffDuration;
+		if (DebuffFrequency > 0.0f) Writer << DebuffFrequency;
+		if (Context.GetDamageType().IsValid())
+		{
+			FGameplayTag DamageType = *Context.GetDamageType();
+			DamageType.NetSerialize(Writer, nullptr, bSuccess);
+		}
+		if (!DeathImpulse.IsZero()) DeathImpulse.NetSerialize(Writer, nullptr, bSuccess);
+		if (!KnockbackForce.IsZero()) KnockbackForce.NetSerialize(Writer, nullptr, bSuccess);
+
+		return Writer.GetNumBits();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraEffectContextSerializationTest, "Aura.AbilitySystem.EffectContextNetSerialize",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraEffectContextSerializationTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraEffectContextSerializationTest;
+
+	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+
+	FAuraGameplayEffectContext Source;
+	Source.SetIsBlockedHit(true);
+	Source.SetIsSuccessfulDebuff(true);
+	Source.SetDebuffDamage(5.25f);
+	Source.SetDebuffDuration(3.0f);
+	Source.SetDebuffFrequency(0.5f);
+	Source.SetDamageType(MakeShared<FGameplayTag>(GameplayTags.Damage_Lightning));
+	Source.SetDeathImpulse(FVector(1000.0f, -500.0f, 250.0f));
+
+	FAuraGameplayEffectContext Target;
+	if (!TestTrue(TEXT("Round trip succeeded"), RoundTrip(Source, Target))) return false;
+
+	TestTrue(TEXT("Blocked hit"), Target.IsBlockedHit());
+	TestFalse(TEXT("Critical hit"), Target.IsCriticalHit());
+	TestTrue(TEXT("Successful debuff"), Target.IsSuccessfulDebuff());
+	TestEqual(TEXT("Debuff damage"), Target.GetDebuffDamage(), 5.25f, 0.01f);
+	TestEqual(TEXT("Debuff duration"), Target.GetDebuffDuration(), 3.0f, 0.01f);
+	TestEqual(TEXT("Debuff frequency"), Target.GetDebuffFrequency(), 0.5f, 0.01f);
+	TestTrue(TEXT("Damage type"), Target.GetDamageType().IsValid() && *Target.GetDamageType() == GameplayTags.Damage_Lightning);
+	TestTrue(TEXT("Death impulse"), Target.GetDeathImpulse().Equals(Source.GetDeathImpulse(), 1.0f));
+	TestTrue(TEXT("Knockback force"), Target.GetKnockbackForce().IsZero());
+
+	// Whatever isn't sent must be reset on the receiving side, not left over from the previous context.
+	FAuraGameplayEffectContext Empty;
+	int64 EmptyNumBits = 0;
+	if (!TestTrue(TEXT("Round trip of an empty context succeeded"), RoundTrip(Empty, Target, &EmptyNumBits))) return false;
+	TestEqual(TEXT("An empty context only sends its RepBits"), EmptyNumBits, static_cast<int64>(16));
+
+	TestFalse(TEXT("Blocked hit reset"), Target.IsBlockedHit());
+	TestFalse(TEXT("Successful debuff reset"), Target.IsSuccessfulDebuff());
+	TestEqual(TEXT("Debuff damage reset"), Target.GetDebuffDamage(), 0.0f);
+	TestFalse(TEXT("Damage type reset"), Target.GetDamageType().IsValid());
+	TestTrue(TEXT("Death impulse reset"), Target.GetDeathImpulse().IsZero());
+
+	// Every damage type goes through the index table & comes back as the same tag.
+	for (const TPair<FGameplayTag, FGameplayTag>& Pair : GameplayTags.DamageTypesToResistances)
+	{
+		FAuraGameplayEffectContext DamageTypeSource;
+		DamageTypeSource.SetDamageType(MakeShared<FGameplayTag>(Pair.Key));
+
+		FAuraGameplayEffectContext DamageTypeTarget;
+		RoundTrip(DamageTypeSource, DamageTypeTarget);
+
+		TestTrue(FString::Printf(TEXT("Damage type %s"), *Pair.Key.ToString()),
+			DamageTypeTarget.GetDamageType().IsValid() && *DamageTypeTarget.GetDamageType() == Pair.Key);
+	}
+
+	// Typical damage contexts, a critical hit with a knockback & a debuffing killing blow.
+	FAuraGameplayEffectContext CriticalHit;
+	CriticalHit.SetIsCriticalHit(true);
+	CriticalHit.SetDamageType(MakeShared<FGameplayTag>(GameplayTags.Damage_Fire));
+	CriticalHit.SetKnockbackForce(FVector(600.0f, 300.0f, 150.0f));
+
+	FAuraGameplayEffectContext DebuffKill;
+	DebuffKill.SetIsSuccessfulDebuff(true);
+	DebuffKill.SetDebuffDamage(5.0f);
+	DebuffKill.SetDebuffDuration(5.0f);
+	DebuffKill.SetDebuffFrequency(1.0f);
+	DebuffKill.SetDamageType(MakeShared<FGameplayTag>(GameplayTags.Damage_Lightning));
+	DebuffKill.SetDeathImpulse(FVector(4000.0f, -2000.0f, 1000.0f));
+
+	const TPair<const TCHAR*, FAuraGameplayEffectContext*> TypicalContexts[] = { { TEXT("Critical hit"), &CriticalHit }, { TEXT("Debuff kill"), &DebuffKill } };
+	for (const TPair<const TCHAR*, FAuraGameplayEffectContext*>& TypicalContext : TypicalContexts)
+	{
+		FAuraGameplayEffectContext TypicalTarget;
+		int64 NumBits = 0;
+		TestTrue(FString::Printf(TEXT("%s round trip succeeded"), TypicalContext.Key), RoundTrip(*TypicalContext.Value, TypicalTarget, &NumBits));
+
+		const int64 PreviousNumBits = GetPreviousFormatNumBits(*TypicalContext.Value);
+		TestTrue(FString::Printf(TEXT("%s takes fewer bits than before"), TypicalContext.Key), NumBits < PreviousNumBits);
+
+		AddInfo(FString::Printf(TEXT("%s: %lld bits, %lld bits in the previous format"), TypicalContext.Key, NumBits, PreviousNumBits));
+	}
+
+	return true;
+}
+
+#endif
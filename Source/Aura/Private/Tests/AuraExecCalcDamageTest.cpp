@@ -0,0 +1,147 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystem/AuraAbilitySystemComponent.h"
+#include "AbilitySystem/AuraAttributeSet.h"
+#include "AbilitySystem/Data/CharacterClassInfo.h"
+#include "AbilitySystem/ExecCalc/ExecCalc_Damage.h"
+#include "AuraGameplayTags.h"
+#include "Game/AuraGameModeBase.h"
+#include "GameplayEffect.h"
+#include "HAL/MallocBase.h"
+#include "Tests/AuraTestWorld.h"
+
+/** Forwards to the allocator it replaces, counting the allocations made from the thread which installed it. */
+class FAuraCountingMalloc final : public FMalloc
+{
+public:
+
+	explicit FAuraCountingMalloc(FMalloc* InInnerMalloc)
+		: InnerMalloc(InInnerMalloc)
+		, ThreadId(FPlatformTLS::GetCurrentThreadId())
+	{
+	}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->Malloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0) CountAllocation();
+		return InnerMalloc->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+	virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+	virtual const TCHAR* GetDescriptiveName() override { return TEXT("AuraCountingMalloc"); }
+
+	int32 GetNumAllocations() const { return NumAllocations; }
+
+private:
+
+	void CountAllocation()
+	{
+		if (FPlatformTLS::GetCurrentThreadId() == ThreadId) ++NumAllocations;
+	}
+
+	FMalloc* InnerMalloc;
+	uint32 ThreadId;
+	int32 NumAllocations = 0;
+};
+
+/** Routes `GMalloc` through a `FAuraCountingMalloc` for its lifetime. */
+struct FAuraScopedAllocationCounter
+{
+	FAuraScopedAllocationCounter()
+		: PreviousMalloc(GMalloc)
+		, CountingMalloc(GMalloc)
+	{
+		GMalloc = &CountingMalloc;
+	}
+
+	~FAuraScopedAllocationCounter()
+	{
+		GMalloc = PreviousMalloc;
+	}
+
+	FMalloc* PreviousMalloc;
+	FAuraCountingMalloc CountingMalloc;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraExecCalcDamageTest, "Aura.AbilitySystem.ExecCalcDamage",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraExecCalcDamageTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumExecutions = 10000;
+
+	FAuraTestWorld TestWorld;
+
+	// `Execute_Implementation()` reads the damage coefficients from the game mode's character class info.
+	AAuraGameModeBase* GameMode = TestWorld.World->SpawnActor<AAuraGameModeBase>();
+	GameMode->CharacterClassInfo = NewObject<UCharacterClassInfo>(GameMode);
+	FObjectProperty* GameModeProperty = FindFProperty<FObjectProperty>(UWorld::StaticClass(), TEXT("AuthorityGameMode"));
+	if (!TestNotNull(TEXT("World game mode property"), GameModeProperty)) return false;
+	GameModeProperty->SetObjectPropertyValue_InContainer(TestWorld.World, GameMode);
+
+	auto SpawnWithAbilitySystem = [&TestWorld](const FVector& Location)
+	{
+		AActor* Actor = TestWorld.World->SpawnActor<AActor>(Location, FRotator::ZeroRotator);
+		UAuraAbilitySystemComponent* AbilitySystemComponent = NewObject<UAuraAbilitySystemComponent>(Actor);
+		AbilitySystemComponent->RegisterComponent();
+		AbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+		AbilitySystemComponent->InitStats(UAuraAttributeSet::StaticClass(), nullptr);
+		return AbilitySystemComponent;
+	};
+
+	UAuraAbilitySystemComponent* SourceAbilitySystemComponent = SpawnWithAbilitySystem(FVector::ZeroVector);
+	UAuraAbilitySystemComponent* TargetAbilitySystemComponent = SpawnWithAbilitySystem(FVector(500.0f, 0.0f, 0.0f));
+
+	// A damage effect like the Blueprint ones, executing `UExecCalc_Damage` & so capturing all of its attributes.
+	UGameplayEffect* DamageEffect = NewObject<UGameplayEffect>(GetTransientPackage());
+	FGameplayEffectExecutionDefinition& Execution = DamageEffect->Executions.AddDefaulted_GetRef();
+	Execution.CalculationClass = UExecCalc_Damage::StaticClass();
+
+	// A plain hit, the debuff chance isn't set so no debuff is applied (which allocates the context's damage type).
+	FGameplayEffectSpec Spec(DamageEffect, SourceAbilitySystemComponent->MakeEffectContext(), 1.0f);
+	Spec.SetSetByCallerMagnitude(FAuraGameplayTags::Get().Damage_Fire, 10.0f);
+	Spec.CaptureAttributeDataFromTarget(TargetAbilitySystemComponent);
+
+	const FGameplayEffectCustomExecutionParameters ExecutionParams(Spec, {}, TargetAbilitySystemComponent, FGameplayTagContainer(), FPredictionKey());
+	const UExecCalc_Damage* ExecCalc = GetDefault<UExecCalc_Damage>();
+
+	// The output belongs to the caller, so its modifiers are reserved up front. The first execution bakes the coefficients.
+	FGameplayEffectCustomExecutionOutput ExecutionOutput;
+	ExecutionOutput.GetOutputModifiersRef().Reserve(NumExecutions + 1);
+	ExecCalc->Execute_Implementation(ExecutionParams, ExecutionOutput);
+
+	int32 NumAllocations = 0;
+	const double StartTime = FPlatformTime::Seconds();
+	{
+		FAuraScopedAllocationCounter AllocationCounter;
+		for (int32 Index = 0; Index < NumExecutions; ++Index)
+		{
+			ExecCalc->Execute_Implementation(ExecutionParams, ExecutionOutput);
+		}
+		NumAllocations = AllocationCounter.CountingMalloc.GetNumAllocations();
+	}
+	const double ExecutionSeconds = (FPlatformTime::Seconds() - StartTime) / NumExecutions;
+
+	TestEqual(TEXT("Every execution outputs its damage"), ExecutionOutput.GetOutputModifiersRef().Num(), NumExecutions + 1);
+	TestEqual(TEXT("Heap allocations per execution"), NumAllocations, 0);
+
+	AddInfo(FString::Printf(TEXT("%d executions: %.4f us per execution, %d heap allocations"),
+		NumExecutions, ExecutionSeconds * 1000000.0, NumAllocations));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,89 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AI/BTService_FindNearestPlayer.h"
+#include "Character/AuraCharacter.h"
+#include "Character/AuraEnemy.h"
+#include "Kismet/GameplayStatics.h"
+#include "Tests/AuraTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraFindNearestPlayerTest, "Aura.AI.FindNearestPlayer",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraFindNearestPlayerTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumEnemies = 500;
+	static constexpr int32 NumPlayers = 4;
+
+	FAuraTestWorld TestWorld;
+
+	TArray<AAuraCharacter*> Players;
+	for (int32 Index = 0; Index < NumPlayers; ++Index)
+	{
+		AAuraCharacter* Player = TestWorld.SpawnCombatant<AAuraCharacter>(FVector(Index * 2000.0f, 0.0f, 0.0f));
+		Player->Tags.Add(FName("Player"));
+		Players.Add(Player);
+	}
+
+	FRandomStream RandomStream(NumEnemies);
+	TArray<AAuraEnemy*> Enemies;
+	for (int32 Index = 0; Index < NumEnemies; ++Index)
+	{
+		const FVector Location(RandomStream.FRandRange(-5000.0f, 10000.0f), RandomStream.FRandRange(-5000.0f, 5000.0f), 0.0f);
+		Enemies.Add(TestWorld.SpawnCombatant<AAuraEnemy>(Location));
+	}
+
+	// One service tick for every enemy, as in a frame where all their services are due.
+	TArray<const AActor*> NativeTargets;
+	NativeTargets.Reserve(NumEnemies);
+	const double StartTime = FPlatformTime::Seconds();
+	for (const AAuraEnemy* Enemy : Enemies)
+	{
+		double DistanceSquared = 0.0;
+		NativeTargets.Add(UBTService_FindNearestPlayer::FindNearestTarget(*Enemy, DistanceSquared));
+	}
+	const double NativeSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// What the Blueprint service did for every enemy, gather all the actors with the tag & compare their distances.
+	TArray<const AActor*> BlueprintTargets;
+	BlueprintTargets.Reserve(NumEnemies);
+	const double BlueprintStartTime = FPlatformTime::Seconds();
+	for (const AAuraEnemy* Enemy : Enemies)
+	{
+		TArray<AActor*> TaggedActors;
+		UGameplayStatics::GetAllActorsWithTag(TestWorld.World, FName("Player"), TaggedActors);
+
+		const AActor* ClosestActor = nullptr;
+		double ClosestDistanceSquared = TNumericLimits<double>::Max();
+		for (const AActor* TaggedActor : TaggedActors)
+		{
+			const double DistanceSquared = FVector::DistSquared(Enemy->GetActorLocation(), TaggedActor->GetActorLocation());
+			if (DistanceSquared < ClosestDistanceSquared)
+			{
+				ClosestDistanceSquared = DistanceSquared;
+				ClosestActor = TaggedActor;
+			}
+		}
+
+		BlueprintTargets.Add(ClosestActor);
+	}
+	const double BlueprintSeconds = FPlatformTime::Seconds() - BlueprintStartTime;
+
+	TestEqual(TEXT("Every enemy finds the same nearest player as the Blueprint service"), NativeTargets, BlueprintTargets);
+	TestFalse(TEXT("Every enemy finds a player"), NativeTargets.Contains(nullptr));
+
+	// The players look for the nearest enemy instead.
+	double PlayerDistanceSquared = 0.0;
+	TestTrue(TEXT("Players target the enemies"),
+		Enemies.Contains(UBTService_FindNearestPlayer::FindNearestTarget(*Players[0], PlayerDistanceSquared)));
+
+	AddInfo(FString::Printf(TEXT("%d enemies, %d players: native %.3f ms, tag gathering %.3f ms"),
+		NumEnemies, NumPlayers, NativeSeconds * 1000.0, BlueprintSeconds * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,109 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystem/AuraAttributeSet.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "UObject/UnrealType.h"
+
+namespace AuraQuantizedAttributeDataTest
+{
+	/** Writes `Source`, reads it back into `OutAttribute` & returns the number of bits it took. */
+	int64 RoundTrip(FAuraQuantizedAttributeData& Source, FAuraQuantizedAttributeData& OutAttribute)
+	{
+		bool bSuccess = false;
+		FBitWriter Writer(0, true);
+		Source.NetSerialize(Writer, nullptr, bSuccess);
+
+		FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+		OutAttribute.NetSerialize(Reader, nullptr, bSuccess);
+
+		return Writer.GetNumBits();
+	}
+
+	int64 RoundTrip(float BaseValue, float CurrentValue, FAuraQuantizedAttributeData& OutAttribute)
+	{
+		FAuraQuantizedAttributeData Source = OutAttribute;
+		Source.SetBaseValue(BaseValue);
+		Source.SetCurrentValue(CurrentValue);
+
+		return RoundTrip(Source, OutAttribute);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraQuantizedAttributeDataTest, "Aura.AbilitySystem.QuantizedAttributeData",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraQuantizedAttributeDataTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraQuantizedAttributeDataTest;
+
+	// Whole numbers & two decimals in the range, as well as anything out of it, come back unchanged.
+	const float ExactValues[] = { 0.0f, 1.0f, 15.0f, 250.0f, 9999.0f, 10000.0f, 0.5f, 87.25f, 12.34f, -10.0f, 10000.5f, 1.0e9f };
+	for (const float Value : ExactValues)
+	{
+		FAuraQuantizedAttributeData Attribute(0.0f, 10000.0f);
+		RoundTrip(Value, Value, Attribute);
+		TestEqual(FString::Printf(TEXT("Base value %f"), Value), Attribute.GetBaseValue(), Value, 0.0f);
+		TestEqual(FString::Printf(TEXT("Current value %f"), Value), Attribute.GetCurrentValue(), Value, 0.0f);
+	}
+
+	// Finer fractions in the range are rounded to the nearest step.
+	FAuraQuantizedAttributeData Rounded(0.0f, 10000.0f);
+	RoundTrip(123.456f, 123.456f, Rounded);
+	TestEqual(TEXT("Value rounded to a step"), Rounded.GetCurrentValue(), 123.46f, KINDA_SMALL_NUMBER);
+
+	// Without a range everything goes as full floats.
+	FAuraQuantizedAttributeData NoRange;
+	RoundTrip(123.456f, 123.456f, NoRange);
+	TestEqual(TEXT("Value without a range"), NoRange.GetCurrentValue(), 123.456f, 0.0f);
+
+	FAuraQuantizedAttributeData Differing(0.0f, 10000.0f);
+	RoundTrip(100.0f, 87.5f, Differing);
+	TestEqual(TEXT("Base value differing from the current value"), Differing.GetBaseValue(), 100.0f, 0.0f);
+	TestEqual(TEXT("Current value differing from the base value"), Differing.GetCurrentValue(), 87.5f, 0.0f);
+
+	// Bits per enemy for every quantized attribute of the set, with an enemy's typical values, against two full floats each.
+	UAuraAttributeSet* AttributeSet = NewObject<UAuraAttributeSet>();
+	AttributeSet->InitMaxHealth(120.0f);
+	AttributeSet->InitHealth(120.0f);
+	AttributeSet->Health.SetCurrentValue(87.5f);
+	AttributeSet->InitArmor(9.25f);
+	AttributeSet->InitArmorPenetration(4.5f);
+	AttributeSet->InitBlockChance(6.75f);
+	AttributeSet->InitCriticalHitChance(3.5f);
+	AttributeSet->InitCriticalHitDamage(7.0f);
+	AttributeSet->InitCriticalHitResistance(5.25f);
+	AttributeSet->InitHealthRegeneration(1.5f);
+	AttributeSet->InitManaRegeneration(2.0f);
+	AttributeSet->InitFireResistance(10.0f);
+
+	int32 NumAttributes = 0;
+	int64 QuantizedBits = 0;
+	for (TFieldIterator<FStructProperty> PropertyIterator(UAuraAttributeSet::StaticClass()); PropertyIterator; ++PropertyIterator)
+	{
+		if (PropertyIterator->Struct != FAuraQuantizedAttributeData::StaticStruct()) continue;
+
+		FAuraQuantizedAttributeData& Source = *PropertyIterator->ContainerPtrToValuePtr<FAuraQuantizedAttributeData>(AttributeSet);
+		FAuraQuantizedAttributeData Received = Source;
+		Received.SetBaseValue(-1.0f);
+		Received.SetCurrentValue(-1.0f);
+		QuantizedBits += RoundTrip(Source, Received);
+		++NumAttributes;
+
+		TestEqual(FString::Printf(TEXT("%s current value"), *PropertyIterator->GetName()), Received.GetCurrentValue(), Source.GetCurrentValue(), 0.0f);
+	}
+
+	const int64 FullFloatBits = NumAttributes * 2 * 32;
+	TestTrue(TEXT("Quantized attributes take fewer bits than full floats"), NumAttributes > 0 && QuantizedBits < FullFloatBits);
+
+	AddInfo(FString::Printf(TEXT("%d quantized attributes: %lld bits per enemy, %lld bits as full floats (%.1f%%)"),
+		NumAttributes, QuantizedBits, FullFloatBits, FullFloatBits > 0 ? 100.0 * QuantizedBits / FullFloatBits : 0.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,137 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "Engine/TargetPoint.h"
+#include "Tests/AuraTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraSelectClosestTargetsTest, "Aura.AbilitySystem.SelectClosestTargets",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraSelectClosestTargetsTest::RunTest(const FString& Parameters)
+{
+	FAuraTestWorld TestWorld;
+
+	const TArray<FVector> Locations = {
+		FVector(500.0f, 0.0f, 0.0f),
+		FVector(100.0f, 0.0f, 0.0f),
+		FVector(0.0f, 300.0f, 0.0f),
+		FVector(0.0f, 0.0f, 200.0f),
+		FVector(-400.0f, 0.0f, 0.0f)
+	};
+
+	TArray<AActor*> Actors;
+	for (const FVector& Location : Locations)
+	{
+		Actors.Add(TestWorld.World->SpawnActor<ATargetPoint>(Location, FRotator::ZeroRotator));
+	}
+
+	// The given locations & the actors' own locations must pick the same targets, closest first.
+	const TArray<AActor*> Expected = { Actors[1], Actors[3], Actors[2] };
+
+	TArray<AActor*> FromLocations;
+	UAuraAbilitySystemLibrary::SelectClosestTargets(3, Actors, Locations, FromLocations, FVector::ZeroVector);
+	TestEqual(TEXT("Closest targets from the given locations"), FromLocations, Expected);
+
+	TArray<AActor*> FromActors;
+	UAuraAbilitySystemLibrary::SelectClosestTargets(3, Actors, TArrayView<const FVector>(), FromActors, FVector::ZeroVector);
+	TestEqual(TEXT("Closest targets from the actor locations"), FromActors, Expected);
+
+	// Asking for more targets than there are returns all of them, still ordered.
+	TArray<AActor*> AllTargets;
+	UAuraAbilitySystemLibrary::SelectClosestTargets(10, Actors, Locations, AllTargets, FVector::ZeroVector);
+	TestEqual(TEXT("Number of targets when asking for more than there are"), AllTargets.Num(), Actors.Num());
+	TestTrue(TEXT("Farthest target comes last"), AllTargets.Num() > 0 && AllTargets.Last() == Actors[0]);
+
+	// Invalid actors are skipped & no targets are selected for a non-positive count.
+	TArray<AActor*> WithInvalid = { nullptr, Actors[4] };
+	TArray<AActor*> ValidOnly;
+	UAuraAbilitySystemLibrary::SelectClosestTargets(2, WithInvalid, TArrayView<const FVector>(), ValidOnly, FVector::ZeroVector);
+	TestEqual(TEXT("Invalid actors are skipped"), ValidOnly, TArray<AActor*>{ Actors[4] });
+
+	TArray<AActor*> NoTargets;
+	UAuraAbilitySystemLibrary::SelectClosestTargets(0, Actors, Locations, NoTargets, FVector::ZeroVector);
+	TestTrue(TEXT("No targets for a zero count"), NoTargets.IsEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraSelectClosestTargetsScalingTest, "Aura.AbilitySystem.SelectClosestTargetsScaling",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraSelectClosestTargetsScalingTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumCandidatesPerRun[] = { 10, 100, 1000, 10000 };
+	static constexpr int32 MaxTargetsPerRun[] = { 1, 4, 8, 16, 32 };
+	static constexpr int32 NumIterations = 20;
+	static constexpr int32 NumActors = 10000;
+
+	FAuraTestWorld TestWorld;
+
+	// Every run takes the first candidates of the same crowd.
+	FRandomStream RandomStream(NumActors);
+	TArray<AActor*> Actors;
+	TArray<FVector> Locations;
+	for (int32 Index = 0; Index < NumActors; ++Index)
+	{
+		const FVector Location(RandomStream.FRandRange(-5000.0f, 5000.0f), RandomStream.FRandRange(-5000.0f, 5000.0f), 0.0f);
+		Actors.Add(TestWorld.World->SpawnActor<ATargetPoint>(Location, FRotator::ZeroRotator));
+		Locations.Add(Location);
+	}
+
+	for (const int32 NumCandidates : NumCandidatesPerRun)
+	{
+		const TArrayView<AActor* const> Candidates(Actors.GetData(), NumCandidates);
+		const TArrayView<const FVector> CandidateLocations(Locations.GetData(), NumCandidates);
+
+		for (const int32 MaxTargets : MaxTargetsPerRun)
+		{
+			TArray<AActor*> Selected;
+			const double SelectStartTime = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				Selected.Reset();
+				UAuraAbilitySystemLibrary::SelectClosestTargets(MaxTargets, Candidates, CandidateLocations, Selected, FVector::ZeroVector);
+			}
+			const double SelectSeconds = (FPlatformTime::Seconds() - SelectStartTime) / NumIterations;
+
+			// What `GetClosestTargets()` did before, a full scan with square roots & a removal for every target found.
+			TArray<AActor*> Scanned;
+			const double ScanStartTime = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				Scanned.Reset();
+				TArray<AActor*> ActorsToCheck(Candidates.GetData(), Candidates.Num());
+				while (Scanned.Num() < MaxTargets && ActorsToCheck.Num() > 0)
+				{
+					AActor* ClosestActor = nullptr;
+					double ClosestDistance = TNumericLimits<double>::Max();
+					for (AActor* Actor : ActorsToCheck)
+					{
+						const double Distance = (Actor->GetActorLocation() - FVector::ZeroVector).Length();
+						if (Distance < ClosestDistance)
+						{
+							ClosestDistance = Distance;
+							ClosestActor = Actor;
+						}
+					}
+					ActorsToCheck.Remove(ClosestActor);
+					Scanned.Add(ClosestActor);
+				}
+			}
+			const double ScanSeconds = (FPlatformTime::Seconds() - ScanStartTime) / NumIterations;
+
+			TestEqual(*FString::Printf(TEXT("Same targets as the full scan for n=%d k=%d"), NumCandidates, MaxTargets), Selected, Scanned);
+
+			AddInfo(FString::Printf(TEXT("n=%d k=%d: heap %.4f ms, full scan %.4f ms"),
+				NumCandidates, MaxTargets, SelectSeconds * 1000.0, ScanSeconds * 1000.0));
+		}
+	}
+
+	return true;
+}
+
+#endif
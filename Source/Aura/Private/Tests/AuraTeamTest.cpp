@@ -0,0 +1,95 @@
+// Copyright - Amey Chavan
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "Character/AuraCharacter.h"
+#include "Character/AuraEnemy.h"
+#include "Interaction/CombatInterface.h"
+#include "Tests/AuraTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraTeamAreFriendsTest, "Aura.Interaction.TeamAreFriends",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraTeamAreFriendsTest::RunTest(const FString& Parameters)
+{
+	// Same as the old "Player"/"Enemy" actor tag checks.
+	TestTrue(TEXT("Players are friends"), AuraTeam::AreFriends(EAuraTeam::Player, EAuraTeam::Player));
+	TestTrue(TEXT("Enemies are friends"), AuraTeam::AreFriends(EAuraTeam::Enemy, EAuraTeam::Enemy));
+	TestFalse(TEXT("Player & enemy aren't friends"), AuraTeam::AreFriends(EAuraTeam::Player, EAuraTeam::Enemy));
+	TestFalse(TEXT("Enemy & player aren't friends"), AuraTeam::AreFriends(EAuraTeam::Enemy, EAuraTeam::Player));
+
+	// An actor without a team is nobody's friend, not even of another one without a team.
+	for (uint8 Team = 0; Team < static_cast<uint8>(EAuraTeam::MAX); ++Team)
+	{
+		TestFalse(TEXT("No team isn't a friend"), AuraTeam::AreFriends(EAuraTeam::None, static_cast<EAuraTeam>(Team)));
+		TestFalse(TEXT("Nobody is a friend of no team"), AuraTeam::AreFriends(static_cast<EAuraTeam>(Team), EAuraTeam::None));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraIsNotFriendHotPathTest, "Aura.Interaction.IsNotFriendHotPath",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraIsNotFriendHotPathTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 NumCombatantsPerTeam = 32;
+	static constexpr int32 NumChecks = 1000000;
+
+	FAuraTestWorld TestWorld;
+
+	// Tagged like the Blueprint characters, for the old tag checks.
+	TArray<AActor*> Combatants;
+	for (int32 Index = 0; Index < NumCombatantsPerTeam; ++Index)
+	{
+		AAuraCharacter* Player = TestWorld.SpawnCombatant<AAuraCharacter>(FVector(Index * 200.0f, 0.0f, 0.0f));
+		Player->Tags.Add(FName("Player"));
+		Combatants.Add(Player);
+
+		AAuraEnemy* Enemy = TestWorld.SpawnCombatant<AAuraEnemy>(FVector(Index * 200.0f, 1000.0f, 0.0f));
+		Enemy->Tags.Add(FName("Enemy"));
+		Combatants.Add(Enemy);
+	}
+
+	// Pairs as a crowd of projectile & beam overlaps would check them, players & enemies mixed.
+	FRandomStream RandomStream(NumChecks);
+	TArray<TPair<AActor*, AActor*>> Pairs;
+	Pairs.Reserve(NumChecks);
+	for (int32 Index = 0; Index < NumChecks; ++Index)
+	{
+		Pairs.Emplace(Combatants[RandomStream.RandHelper(Combatants.Num())], Combatants[RandomStream.RandHelper(Combatants.Num())]);
+	}
+
+	TArray<bool> NotFriends;
+	NotFriends.Reserve(NumChecks);
+	const double TeamStartTime = FPlatformTime::Seconds();
+	for (const TPair<AActor*, AActor*>& Pair : Pairs)
+	{
+		NotFriends.Add(UAuraAbilitySystemLibrary::IsNotFriend(Pair.Key, Pair.Value));
+	}
+	const double TeamSeconds = FPlatformTime::Seconds() - TeamStartTime;
+
+	// What `IsNotFriend()` did before the teams.
+	TArray<bool> NotFriendsByTags;
+	NotFriendsByTags.Reserve(NumChecks);
+	const double TagStartTime = FPlatformTime::Seconds();
+	for (const TPair<AActor*, AActor*>& Pair : Pairs)
+	{
+		const bool bBothAreFriends = Pair.Key->ActorHasTag("Player") && Pair.Value->ActorHasTag("Player");
+		const bool bBothAreEnemies = Pair.Key->ActorHasTag("Enemy") && Pair.Value->ActorHasTag("Enemy");
+		NotFriendsByTags.Add(!(bBothAreFriends || bBothAreEnemies));
+	}
+	const double TagSeconds = FPlatformTime::Seconds() - TagStartTime;
+
+	TestTrue(TEXT("Every pair gets the same answer as the tag checks"), NotFriends == NotFriendsByTags);
+
+	AddInfo(FString::Printf(TEXT("%d checks: teams %.3f ms, actor tags %.3f ms"),
+		NumChecks, TeamSeconds * 1000.0, TagSeconds * 1000.0));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,49 @@
+// Copyright - Amey Chavan
+
+#pragma once
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Game/AuraCombatantGridSubsystem.h"
+#include "GameFramework/Pawn.h"
+
+/** Bare game world for the automation tests which need to spawn actors, destroyed along with this. */
+struct FAuraTestWorld
+{
+	FAuraTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false);
+		GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+	}
+
+	~FAuraTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	/**
+	 * Spawns a combatant without an AI controller & registers it with the combatant grid by hand,
+	 * since the bare world never begins play & so never calls the combatants' `BeginPlay()`.
+	 */
+	template <typename T>
+	T* SpawnCombatant(const FVector& Location)
+	{
+		T* Combatant = World->SpawnActorDeferred<T>(T::StaticClass(), FTransform(Location));
+		Combatant->AutoPossessAI = EAutoPossessAI::Disabled;
+		Combatant->FinishSpawning(FTransform(Location));
+
+		World->GetSubsystem<UAuraCombatantGridSubsystem>()->RegisterCombatant(Combatant);
+		return Combatant;
+	}
+
+	FAuraTestWorld(const FAuraTestWorld&) = delete;
+	FAuraTestWorld& operator=(const FAuraTestWorld&) = delete;
+
+	UWorld* World = nullptr;
+};
+
+#endif
@@ -3,3 +3,64 @@
 
 #include "UI/Widget/DamageTextComponent.h"
 
+#include "Aura/Aura.h"
+#include "Blueprint/UserWidget.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Damage Texts Showing"), STAT_AuraDamageTextsShowing, STATGROUP_Aura);
+
+void UDamageTextComponent::ShowDamageText(float Damage, bool bBlockedHit, bool bCriticalHit, int32 InHitCount)
+{
+	HitCount = InHitCount;
+
+	if (!bShowingDamageText)
+	{
+		bShowingDamageText = true;
+		INC_DWORD_STAT(STAT_AuraDamageTextsShowing);
+	}
+
+	/**
+	 * A reused component may still have the `Delay` of its previous show counting down, which would finish this show early
+	 * (and a new `Delay` node call is ignored while the old one is pending). Drop it so the lifetime restarts from here.
+	 */
+	if (UWorld* World = GetWorld())
+	{
+		FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+		LatentActionManager.RemoveActionsForObject(this);
+		if (UUserWidget* DamageTextWidget = GetUserWidgetObject())
+		{
+			LatentActionManager.RemoveActionsForObject(DamageTextWidget);
+		}
+	}
+
+	SetVisibility(true);
+	SetDamageText(Damage, bBlockedHit, bCriticalHit);
+}
+
+void UDamageTextComponent::FinishDamageText()
+{
+	if (bShowingDamageText)
+	{
+		bShowingDamageText = false;
+		DEC_DWORD_STAT(STAT_AuraDamageTextsShowing);
+	}
+
+	SetVisibility(false);
+}
+
+void UDamageTextComponent::DestroyComponent(bool bPromoteChildren)
+{
+	/** Keep the pooled component alive unless its owner (i.e. the player controller) is going away. */
+	if (bPooled && IsValid(GetOwner()) && !GetOwner()->IsActorBeingDestroyed())
+	{
+		FinishDamageText();
+		return;
+	}
+
+	if (bShowingDamageText)
+	{
+		bShowingDamageText = false;
+		DEC_DWORD_STAT(STAT_AuraDamageTextsShowing);
+	}
+
+	Super::DestroyComponent(bPromoteChildren);
+}
@@ -6,7 +6,7 @@
 #include "AIController.h"
 #include "AuraAIController.generated.h"
 
-class UBehaviorTreeComponent;
+class UAuraBehaviorTreeComponent;
 
 /**
  * 
@@ -22,6 +22,7 @@ public:
 
 protected:
 
+	/** Set as the brain component, so that `RunBehaviorTree()` uses it instead of creating a plain one. */
 	UPROPERTY()
-	TObjectPtr<UBehaviorTreeComponent> BehaviorTreeComponent;
+	TObjectPtr<UAuraBehaviorTreeComponent> BehaviorTreeComponent;
 };
@@ -0,0 +1,63 @@
+// Copyright - Amey Chavan
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraAISignificanceSubsystem.generated.h"
+
+class AAuraEnemy;
+
+/** How much an enemy's AI matters right now, from the most to the least significant. */
+UENUM(BlueprintType)
+enum class EAuraAISignificance : uint8
+{
+	High,
+	Medium,
+	Low,
+	Dormant,
+
+	MAX UMETA(Hidden)
+};
+
+/**
+ * Server side AI level of detail for the enemies.
+ *
+ * Every `UpdateInterval` seconds the registered enemies are put into a significance bucket by their distance to the
+ * nearest live player, and by being recently rendered (which only matters on a listen server or standalone, a dedicated
+ * server doesn't render anything). Each enemy then throttles its behavior tree (and so its EQS queries),
+ * character movement & mesh animation ticks for its bucket, see `AAuraEnemy::SetAISignificance()`.
+ * While there's no live player the enemies keep their current buckets.
+ */
+UCLASS()
+class AURA_API UAuraAISignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterEnemy(AAuraEnemy* Enemy);
+	void UnregisterEnemy(AAuraEnemy* Enemy);
+
+private:
+
+	void UpdateSignificance();
+
+	EAuraAISignificance CalculateSignificance(const AAuraEnemy* Enemy, TConstArrayView<FVector> PlayerLocations) const;
+
+	TArray<TWeakObjectPtr<AAuraEnemy>> Enemies;
+
+	float TimeSinceUpdate = 0.0f;
+
+	static constexpr float UpdateInterval = 0.25f;
+
+	/** Maximum distance to the nearest player for the `High`, `Medium` & `Low` buckets, anything farther is `Dormant`. */
+	static constexpr float BucketMaxDistances[] = { 1500.0f, 3000.0f, 6000.0f };
+
+	/** Recently rendered enemies are at least this significant. */
+	static constexpr EAuraAISignificance RenderedSignificance = EAuraAISignificance::Medium;
+};
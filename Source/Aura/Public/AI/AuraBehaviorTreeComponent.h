@@ -0,0 +1,36 @@
+// Copyright - Amey Chavan
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "AuraBehaviorTreeComponent.generated.h"
+
+/**
+ * Behavior tree component which can be throttled to tick the tree at most every `MinTickInterval` seconds.
+ *
+ * The tree schedules its own tick interval at the end of every tick (e.g. for its next service or a waiting task),
+ * overwriting whatever interval was set on the component from the outside. So the throttle is applied on top of the
+ * tree's own schedule, right after each tick. Execution requests (e.g. a Blackboard value observed by a decorator
+ * changing) still tick the tree on the next frame, the throttle only spaces out the ticks after that.
+ */
+UCLASS()
+class AURA_API UAuraBehaviorTreeComponent : public UBehaviorTreeComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** Zero lets the tree tick as often as it asks for. */
+	void SetMinTickInterval(float NewMinTickInterval);
+
+	float GetMinTickInterval() const { return MinTickInterval; }
+
+private:
+
+	void ApplyMinTickInterval();
+
+	float MinTickInterval = 0.0f;
+};
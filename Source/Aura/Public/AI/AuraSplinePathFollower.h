@@ -0,0 +1,44 @@
+// Copyright - Amey Chavan
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USplineComponent;
+
+/**
+ * Follows a path stored in a `USplineComponent` without searching the whole spline every tick.
+ *
+ * `USplineComponent::FindLocationClosestToWorldLocation()` & co. check every segment of the spline each time.
+ * Since the follower only ever moves forward along the path, this remembers the input key reached so far and
+ * only checks the segments from there up to `LookAheadSegments` ahead. The whole spline is searched again only when
+ * the follower ends up farther than `MaxDeviation` from that part of the path (e.g. after being knocked back).
+ *
+ * Not tied to the player controller, any `USplineComponent` path (like an AI's) can be followed with it.
+ * `Reset()` must be called whenever the spline points are changed.
+ */
+struct AURA_API FAuraSplinePathFollower
+{
+	/** Start following the path from its beginning. */
+	void Reset();
+
+	/**
+	 * Advances along the `Spline` for the follower being at `WorldLocation`.
+	 *
+	 * @param OutLocationOnSpline Location on the spline closest to the follower, in world space.
+	 * @param OutDirection Direction of the spline at that location, in world space.
+	 */
+	void Update(const USplineComponent& Spline, const FVector& WorldLocation, FVector& OutLocationOnSpline, FVector& OutDirection);
+
+	float GetCurrentInputKey() const { return CurrentInputKey; }
+
+	/** Number of segments ahead of the current one to look at before falling back to a full search. */
+	int32 LookAheadSegments = 2;
+
+	/** Distance from the spline (in the spline's local space) beyond which the whole spline is searched again. */
+	float MaxDeviation = 200.0f;
+
+private:
+
+	float CurrentInputKey = 0.0f;
+};
@@ -0,0 +1,46 @@
+// Copyright - Amey Chavan
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BTService.h"
+#include "BTService_FindNearestPlayer.generated.h"
+
+class APawn;
+
+/**
+ * Native version of the `BTS_FindNearestPlayer` Blueprint service.
+ *
+ * Finds the nearest live target of the opposite team (players for the enemies, enemies for the player's minions)
+ * from the shared per-frame list of `UAuraCombatantGridSubsystem`, instead of gathering all the actors with a tag
+ * for every enemy, and writes it & its distance to the Blackboard through the key IDs resolved with the tree asset.
+ *
+ * Migrating a behavior tree (`BT_EnemyBehaviorTree` & `BT_EnemyBehaviorTree_Elementalist` still use the Blueprint one):
+ *  1. Add this service next to `BTS_FindNearestPlayer` on the same composite node, with the same interval & random deviation.
+ *  2. Pick the same Blackboard keys, `TargetToFollow` for "Target To Follow Selector" & `DistanceToTarget` for "Distance To Target Selector".
+ *  3. Remove the `BTS_FindNearestPlayer` node. Once no tree references it, the Blueprint service asset can be deleted.
+ */
+UCLASS()
+class AURA_API UBTService_FindNearestPlayer : public UBTService
+{
+	GENERATED_BODY()
+
+public:
+
+	UBTService_FindNearestPlayer();
+
+	virtual void InitializeFromAsset(UBehaviorTree& Asset) override;
+
+	/** Nearest live combatant of the team `OwningPawn` targets, or nullptr if there is none. */
+	static AActor* FindNearestTarget(const APawn& OwningPawn, double& OutDistanceSquared);
+
+protected:
+
+	virtual void TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) override;
+
+	UPROPERTY(EditAnywhere, Category = "Blackboard")
+	FBlackboardKeySelector TargetToFollowSelector;
+
+	UPROPERTY(EditAnywhere, Category = "Blackboard")
+	FBlackboardKeySelector DistanceToTargetSelector;
+};
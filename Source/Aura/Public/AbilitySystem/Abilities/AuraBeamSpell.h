@@ -28,6 +28,27 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void StoreAdditionalTargets(TArray<AActor*>& OutAdditionalTargets);
 
+	/**
+	 * Applies the beam's damage to the primary target & the live additional targets from `StoreAdditionalTargets()`
+	 * in one batch, see `CauseDamageToTargets()`.
+	 */
+	UFUNCTION(BlueprintCallable)
+	void CauseDamageToBeamTargets();
+
+	/**
+	 * Calls `CauseDamageToBeamTargets()` right away & then every `BeamDamageInterval` seconds until the ability ends,
+	 * only with authority.
+	 *
+	 * `GA_Electrocute` still applies the damage on its own, one `ApplyDamageEffect()` per target from its `DamageAndCost`
+	 * timer. To switch it over, call this once the targets are stored & remove the `ApplyDamage` call from `DamageAndCost`,
+	 * which keeps applying the cost.
+	 */
+	UFUNCTION(BlueprintCallable)
+	void StartBeamDamage();
+
+	virtual void EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+	                        const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled) override;
+
 	UFUNCTION(BlueprintImplementableEvent)
 	void PrimaryTargetDied(AActor* DeadActor);
 
@@ -50,4 +71,14 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, Category = "Beam")
 	int32 MaxNumShockTargets = 5;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Beam")
+	TArray<TObjectPtr<AActor>> AdditionalTargets;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Beam")
+	float BeamDamageInterval = 0.1f;
+
+private:
+
+	FTimerHandle BeamDamageTimerHandle;
 };
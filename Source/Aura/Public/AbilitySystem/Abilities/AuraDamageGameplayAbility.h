@@ -21,6 +21,10 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void CauseDamage(AActor* TargetActor);
 
+	/** Applies this ability's damage to all the `TargetActors` at once, see `UAuraAbilitySystemLibrary::ApplyDamageEffectToTargets()`. */
+	UFUNCTION(BlueprintCallable)
+	void CauseDamageToTargets(const TArray<AActor*>& TargetActors);
+
 	UFUNCTION(BlueprintPure)
 	FDamageEffectParams MakeDamageEffectParamsFromClassDefaults(AActor* TargetActor = nullptr) const;
 
@@ -35,18 +35,24 @@ public:
 
 	void ForEachAbility(const FForEachAbility& Delegate);
 
-	static FGameplayTag GetAbilityTagFromSpec(const FGameplayAbilitySpec& AbilitySpec);
-	static FGameplayTag GetInputTagFromSpec(const FGameplayAbilitySpec& AbilitySpec);
-	static FGameplayTag GetStatusFromSpec(const FGameplayAbilitySpec& AbilitySpec);
+	FGameplayTag GetAbilityTagFromSpec(const FGameplayAbilitySpec& AbilitySpec) const;
+	FGameplayTag GetInputTagFromSpec(const FGameplayAbilitySpec& AbilitySpec) const;
+	FGameplayTag GetStatusFromSpec(const FGameplayAbilitySpec& AbilitySpec) const;
 	FGameplayTag GetStatusFromAbilityTag(const FGameplayTag& AbilityTag);
 	FGameplayTag GetSlotFromAbilityTag(const FGameplayTag& AbilityTag);
 	bool SlotIsEmpty(const FGameplayTag& Slot);
 	static bool AbilityHasSlot(const FGameplayAbilitySpec& Spec, const FGameplayTag& Slot);
-	static bool AbilityHasAnySlot(const FGameplayAbilitySpec& Spec);
+	bool AbilityHasAnySlot(const FGameplayAbilitySpec& Spec) const;
 	FGameplayAbilitySpec* GetSpecWithSlot(const FGameplayTag& Slot);
 	FGameplayAbilitySpec* GetSpecFromAbilityTag(const FGameplayTag& AbilityTag);
 	bool IsPassiveAbility(const FGameplayAbilitySpec& Spec) const;
-	static void AssignSlotToAbility(FGameplayAbilitySpec& Spec, const FGameplayTag& Slot);
+	void AssignSlotToAbility(FGameplayAbilitySpec& Spec, const FGameplayTag& Slot);
+
+	/** Replaces the status tag of `Spec` (e.g. 'Eligible' with 'Unlocked'), keeping the ability spec index up to date. */
+	void SetAbilityStatus(FGameplayAbilitySpec& Spec, const FGameplayTag& Status);
+
+	/** Specs visited by rebuilding the ability spec index & by lookups falling back to a scan, for the automation tests. */
+	uint32 GetNumSpecsScannedByIndex() const { return NumSpecsScannedByIndex; }
 
 	UFUNCTION(NetMulticast, Unreliable)
 	void MulticastActivatePassiveEffect(const FGameplayTag& AbilityTag, bool bActivate);
@@ -69,7 +75,7 @@ public:
 
 	bool GetDescriptionsByAbilityTag(const FGameplayTag& AbilityTag, FString& OutDescription, FString& OutNextLevelDescription);
 
-	static void ClearSlot(FGameplayAbilitySpec* Spec);
+	void ClearSlot(FGameplayAbilitySpec* Spec);
 	void ClearAbilitiesOfSlot(const FGameplayTag& Slot);
 
 	FEffectAssetTags EffectAssetTags;
@@ -97,10 +103,61 @@ public:
 protected:
 
 	virtual void OnRep_ActivateAbilities() override;
+	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
 
 	UFUNCTION(Client, Reliable)
 	void ClientEffectApplied(UAbilitySystemComponent* AbilitySystemComponent, const FGameplayEffectSpec& EffectSpec, FActiveGameplayEffectHandle ActiveEffectHandle);
 
 	UFUNCTION(Client, Reliable)
 	void ClientUpdateAbilityStatus(const FGameplayTag& AbilityTag, const FGameplayTag& StatusTag, int32 AbilityLevel);
+
+private:
+
+	/**
+	 * Lookup tables over `ActivatableAbilities`, so the spell menu, equip RPCs and input handlers don't have to scan
+	 * every spec (and every spec's tag containers) to find an ability by its tag or slot, or a spec's status.
+	 *
+	 * `InputTagToSpecHandles` holds one bucket per input tag (slot), which is all the input callbacks have to visit.
+	 *
+	 * The whole index is lazily rebuilt after abilities are given or removed (and on clients, whenever
+	 * `ActivatableAbilities` replicates), while slot/status changes made on the server patch only the affected entry
+	 * through `UpdateAbilitySpecIndex()`.
+	 *
+	 * There's no status to specs table, every status lookup (spell menu, equip & spend RPCs) starts from an ability tag
+	 * or a spec & reads the status cached in that spec's entry.
+	 */
+	struct FAbilitySpecIndexEntry
+	{
+		FGameplayTag AbilityTag;
+		FGameplayTag InputTag;
+		FGameplayTag StatusTag;
+
+		/** Position of the spec within `ActivatableAbilities.Items`, validated against the handle on every lookup. */
+		int32 SpecIndex = INDEX_NONE;
+	};
+
+	TMap<FGameplayAbilitySpecHandle, FAbilitySpecIndexEntry> SpecHandleToIndexEntry;
+	TMap<FGameplayTag, FGameplayAbilitySpecHandle> AbilityTagToSpecHandle;
+	TMap<FGameplayTag, TArray<FGameplayAbilitySpecHandle>> InputTagToSpecHandles;
+
+	bool bAbilitySpecIndexDirty = true;
+
+	uint32 NumSpecsScannedByIndex = 0;
+
+	void MarkAbilitySpecIndexDirty();
+	void RebuildAbilitySpecIndexIfDirty();
+	void UpdateAbilitySpecIndex(const FGameplayAbilitySpec& AbilitySpec);
+	FGameplayAbilitySpec* GetIndexedSpec(const FGameplayAbilitySpecHandle& Handle);
+	void GetSpecHandlesWithInputTag(const FGameplayTag& InputTag, TArray<FGameplayAbilitySpecHandle, TInlineAllocator<4>>& OutHandles);
+
+	/**
+	 * Returns the cached tags of `AbilitySpec`, or `nullptr` while the index is waiting for a rebuild. The `Get*FromSpec()`
+	 * getters fall back to the `Find*InSpec()` functions below in that case.
+	 */
+	const FAbilitySpecIndexEntry* FindAbilitySpecIndexEntry(const FGameplayAbilitySpec& AbilitySpec) const;
+
+	static FGameplayTag FindAbilityTagInSpec(const FGameplayAbilitySpec& AbilitySpec);
+	static FGameplayTag FindInputTagInSpec(const FGameplayAbilitySpec& AbilitySpec);
+	static FGameplayTag FindStatusInSpec(const FGameplayAbilitySpec& AbilitySpec);
 };
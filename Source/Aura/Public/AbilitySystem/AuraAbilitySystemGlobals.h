@@ -4,8 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "AbilitySystemGlobals.h"
+#include "GameplayTagContainer.h"
 #include "AuraAbilitySystemGlobals.generated.h"
 
+class UGameplayEffect;
+
 /**
  * 
  */
@@ -17,4 +20,26 @@ class AURA_API UAuraAbilitySystemGlobals : public UAbilitySystemGlobals
 public:
 
 	virtual FGameplayEffectContext* AllocGameplayEffectContext() const override;
+
+	/**
+	 * Returns the debuff Gameplay Effect for `DamageType` which ticks every `Frequency` seconds, creating it the first
+	 * time it's asked for.
+	 *
+	 * The damage per tick is a SetByCaller magnitude with the 'Debuff.Damage' tag and the duration is meant to be set
+	 * (and locked) on each spec, so the same effect can be shared by every debuff of that damage type and frequency
+	 * instead of creating a new transient Gameplay Effect per application.
+	 */
+	UGameplayEffect* GetDebuffEffect(const FGameplayTag& DamageType, float Frequency);
+
+	int32 GetNumDebuffEffects() const { return DebuffEffects.Num(); }
+
+private:
+
+	UGameplayEffect* CreateDebuffEffect(const FGameplayTag& DamageType, float Frequency);
+
+	/** Keeps the created debuff effects alive, this object itself is rooted by the Gameplay Abilities module. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UGameplayEffect>> DebuffEffects;
+
+	TMap<TPair<FGameplayTag, float>, UGameplayEffect*> DamageTypeAndFrequencyToDebuffEffect;
 };
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Data/CharacterClassInfo.h"
+#include "Interaction/CombatInterface.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "AuraAbilitySystemLibrary.generated.h"
 
@@ -13,6 +14,7 @@ class AAuraHUD;
 struct FWidgetControllerParams;
 class USpellMenuWidgetController;
 struct FGameplayEffectContextHandle;
+struct FGameplayEffectSpecHandle;
 struct FGameplayTag;
 class UAbilitySystemComponent;
 class UAttributeMenuWidgetController;
@@ -109,15 +111,51 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AuraAbilitySystemLibrary|GameplayMechanics")
 	static void GetLivePlayersWithinRadius(const UObject* WorldContextObject, TArray<AActor*>& OutOverlappingActors, const TArray<AActor*>& ActorsToIgnore, float Radius, const FVector& SphereOrigin);
 
+	/** Same as `GetLivePlayersWithinRadius()`, but only collects the actors which are NOT friends of `FriendlyToActor`. */
+	UFUNCTION(BlueprintCallable, Category = "AuraAbilitySystemLibrary|GameplayMechanics")
+	static void GetLiveHostilesWithinRadius(const UObject* WorldContextObject, TArray<AActor*>& OutOverlappingActors, const TArray<AActor*>& ActorsToIgnore, float Radius, const FVector& SphereOrigin, AActor* FriendlyToActor);
+
+	/**
+	 * Same as `GetLiveHostilesWithinRadius()`, but also appends the location of each collected actor to `OutLocations`
+	 * in the same order, so they can be handed to `SelectClosestTargets()` without being looked up again.
+	 */
+	static void GetLiveHostilesWithLocationsWithinRadius(const UObject* WorldContextObject, TArray<AActor*>& OutOverlappingActors, TArray<FVector>& OutLocations, const TArray<AActor*>& ActorsToIgnore, float Radius, const FVector& SphereOrigin, AActor* FriendlyToActor);
+
 	UFUNCTION(BlueprintCallable, Category = "AuraAbilitySystemLibrary|GameplayMechanics")
 	static void GetClosestTargets(int32 MaxTargets, const TArray<AActor*>& Actors, TArray<AActor*>& OutClosestTargets, const FVector& Origin);
 
+	/**
+	 * Selects the `MaxTargets` actors closest to `Origin`, ordered from the closest one, with a bounded max-heap of squared
+	 * distances, i.e. O(n log k) without any square roots.
+	 *
+	 * @param ActorLocations Optional locations of `Actors` (same order & size) if the caller already has them,
+	 * otherwise `GetActorLocation()` is used for each actor.
+	 */
+	static void SelectClosestTargets(int32 MaxTargets, TArrayView<AActor* const> Actors, TArrayView<const FVector> ActorLocations, TArray<AActor*>& OutClosestTargets, const FVector& Origin);
+
 	UFUNCTION(BlueprintPure, Category = "AuraAbilitySystemLibrary|GameplayMechanics")
 	static bool IsNotFriend(AActor* FirstActor, AActor* SecondActor);
 
+	/**
+	 * Team of the actor from `ICombatInterface::GetTeam()`.
+	 * Actors not implementing the combat interface still get their team from the "Player"/"Enemy" actor tags.
+	 */
+	UFUNCTION(BlueprintPure, Category = "AuraAbilitySystemLibrary|GameplayMechanics")
+	static EAuraTeam GetActorTeam(const AActor* Actor);
+
 	UFUNCTION(BlueprintCallable, Category = "AuraAbilitySystemLibrary|DamageEffect")
 	static FGameplayEffectContextHandle ApplyDamageEffect(const FDamageEffectParams& DamageEffectParams);
 
+	/**
+	 * Applies the same damage to several targets, building the outgoing spec only once and applying a copy of it
+	 * (with its own effect context) to each target.
+	 *
+	 * `TargetAbilitySystemComponent` of the params is ignored. The death impulse and knockback force are worked out per
+	 * target from `DeathImpulseMagnitude`, `KnockbackForceMagnitude` and `KnockbackChance` when those are set, the
+	 * same way `UAuraDamageGameplayAbility::MakeDamageEffectParamsFromClassDefaults()` does for a single target.
+	 */
+	static void ApplyDamageEffectToTargets(const FDamageEffectParams& DamageEffectParams, TArrayView<UAbilitySystemComponent* const> TargetAbilitySystemComponents);
+
 	UFUNCTION(BlueprintPure, Category = "AuraAbilitySystemLibrary|GameplayMechanics")
 	static TArray<FRotator> EvenlySpacedRotators(const FVector& Forward, const FVector& Axis, float Spread, int32 NumRotators);
 
@@ -125,4 +163,10 @@ public:
 	static TArray<FVector> EvenlyRotatedVectors(const FVector& Forward, const FVector& Axis, float Spread, int32 NumVectors);
 
 	static int32 GetXPRewardForClassAndLevel(const UObject* WorldContextObject, ECharacterClass CharacterClass, int32 CharacterLevel);
+
+private:
+
+	static FGameplayEffectSpecHandle MakeDamageEffectSpec(const FDamageEffectParams& DamageEffectParams, FGameplayEffectContextHandle& OutEffectContextHandle);
+
+	static void CollectLiveHostilesWithinRadius(const UObject* WorldContextObject, TArray<AActor*>& OutOverlappingActors, TArray<FVector>* OutLocations, const TArray<AActor*>& ActorsToIgnore, float Radius, const FVector& SphereOrigin, AActor* FriendlyToActor);
 };
@@ -47,6 +47,61 @@ struct FEffectProperties
 	TObjectPtr<ACharacter> TargetCharacter = nullptr;
 };
 
+/**
+ * `FGameplayAttributeData` which replicates its values within [QuantizeMin, QuantizeMax] as packed integers
+ * in `QuantizeStep`s instead of two full floats, for the attributes the clients only display (health bars, the attribute menu).
+ * Whole numbers & values with up to two decimals come back unchanged, e.g. a health of 250 goes in 2 bytes.
+ *
+ * Opt-in per attribute, the range is given where the attribute is declared,
+ *
+ *		FAuraQuantizedAttributeData BlockChance = FAuraQuantizedAttributeData(0.0f, 100.0f);
+ *
+ * Values outside of the range are sent as full floats, & the current value is skipped when it matches the base value.
+ * Don't use it for the attributes the owning client predicts (e.g. Mana for the ability costs),
+ * the rounded base value would fight with the predicted modifiers.
+ */
+USTRUCT(BlueprintType)
+struct AURA_API FAuraQuantizedAttributeData : public FGameplayAttributeData
+{
+	GENERATED_BODY()
+
+	FAuraQuantizedAttributeData() {}
+
+	FAuraQuantizedAttributeData(float InQuantizeMin, float InQuantizeMax)
+		: QuantizeMin(InQuantizeMin)
+		, QuantizeMax(InQuantizeMax)
+	{
+	}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	static constexpr float QuantizeStep = 0.01f;
+
+private:
+
+	void SerializeQuantizedValue(FArchive& Ar, float& Value) const;
+
+	/** Not replicated, both the server & the clients get the range from the attribute declaration. */
+	float QuantizeMin = 0.0f;
+	float QuantizeMax = 0.0f;
+
+	/** Steps per unit, multiplied & divided by instead of `QuantizeStep` which isn't exact as a float. */
+	static constexpr float StepsPerUnit = 100.0f;
+
+	/** Largest range whose steps all fit in the packed integer. */
+	static constexpr float MaxQuantizeRange = 40000000.0f;
+};
+
+template<>
+struct TStructOpsTypeTraits<FAuraQuantizedAttributeData> : public TStructOpsTypeTraitsBase2<FAuraQuantizedAttributeData>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithCopy = true,
+	};
+};
+
 /**
  * The following `typedef` approach would be specific to the `FGameplayAttribute()` signature:
  *
@@ -71,6 +126,7 @@ public:
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue) override;
+	virtual void PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const override;
 	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
 	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
 
@@ -106,47 +162,47 @@ public:
 
 	// Armor.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_Armor, Category = "Secondary Attributes")
-	FGameplayAttributeData Armor;
+	FAuraQuantizedAttributeData Armor = FAuraQuantizedAttributeData(0.0f, 100.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, Armor);
 
 	// Armor Penetration.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_ArmorPenetration, Category = "Secondary Attributes")
-	FGameplayAttributeData ArmorPenetration;
+	FAuraQuantizedAttributeData ArmorPenetration = FAuraQuantizedAttributeData(0.0f, 100.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, ArmorPenetration);
 
 	// Block Chance.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_BlockChance, Category = "Secondary Attributes")
-	FGameplayAttributeData BlockChance;
+	FAuraQuantizedAttributeData BlockChance = FAuraQuantizedAttributeData(0.0f, 100.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, BlockChance);
 
 	// Critical Hit Chance.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_CriticalHitChance, Category = "Secondary Attributes")
-	FGameplayAttributeData CriticalHitChance;
+	FAuraQuantizedAttributeData CriticalHitChance = FAuraQuantizedAttributeData(0.0f, 100.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, CriticalHitChance);
 
 	// Critical Hit Damage.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_CriticalHitDamage, Category = "Secondary Attributes")
-	FGameplayAttributeData CriticalHitDamage;
+	FAuraQuantizedAttributeData CriticalHitDamage = FAuraQuantizedAttributeData(0.0f, 500.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, CriticalHitDamage);
 
 	// Critical Hit Resistance.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_CriticalHitResistance, Category = "Secondary Attributes")
-	FGameplayAttributeData CriticalHitResistance;
+	FAuraQuantizedAttributeData CriticalHitResistance = FAuraQuantizedAttributeData(0.0f, 100.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, CriticalHitResistance);
 
 	// Health Regeneration.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_HealthRegeneration, Category = "Secondary Attributes")
-	FGameplayAttributeData HealthRegeneration;
+	FAuraQuantizedAttributeData HealthRegeneration = FAuraQuantizedAttributeData(0.0f, 100.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, HealthRegeneration);
 
 	// Mana Regeneration.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_ManaRegeneration, Category = "Secondary Attributes")
-	FGameplayAttributeData ManaRegeneration;
+	FAuraQuantizedAttributeData ManaRegeneration = FAuraQuantizedAttributeData(0.0f, 100.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, ManaRegeneration);
 
 	// Maximum Health.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_MaxHealth, Category = "Secondary Attributes")
-	FGameplayAttributeData MaxHealth;
+	FAuraQuantizedAttributeData MaxHealth = FAuraQuantizedAttributeData(0.0f, 10000.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, MaxHealth);
 
 	// Maximum Mana.
@@ -160,22 +216,22 @@ public:
 
 	// Resistance Fire.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_FireResistance, Category = "Resistance Attributes")
-	FGameplayAttributeData FireResistance;
+	FAuraQuantizedAttributeData FireResistance = FAuraQuantizedAttributeData(0.0f, 100.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, FireResistance);
 
 	// Resistance Lightning.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_LightningResistance, Category = "Resistance Attributes")
-	FGameplayAttributeData LightningResistance;
+	FAuraQuantizedAttributeData LightningResistance = FAuraQuantizedAttributeData(0.0f, 100.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, LightningResistance);
 
 	// Resistance Arcane.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_ArcaneResistance, Category = "Resistance Attributes")
-	FGameplayAttributeData ArcaneResistance;
+	FAuraQuantizedAttributeData ArcaneResistance = FAuraQuantizedAttributeData(0.0f, 100.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, ArcaneResistance);
 
 	// Resistance Physical.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_PhysicalResistance, Category = "Resistance Attributes")
-	FGameplayAttributeData PhysicalResistance;
+	FAuraQuantizedAttributeData PhysicalResistance = FAuraQuantizedAttributeData(0.0f, 100.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, PhysicalResistance);
 
 	/*
@@ -184,7 +240,7 @@ public:
 
 	// Health.
 	UPROPERTY(BlueprintReadOnly, ReplicatedUsing = OnRep_Health, Category = "Vital Attributes")
-	FGameplayAttributeData Health;
+	FAuraQuantizedAttributeData Health = FAuraQuantizedAttributeData(0.0f, 10000.0f);
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, Health);
 
 	// Mana.
@@ -219,55 +275,58 @@ public:
 	void OnRep_Vigor(const FGameplayAttributeData& OldVigor) const;
 
 	UFUNCTION()
-	void OnRep_Health(const FGameplayAttributeData& OldHealth) const;
+	void OnRep_Health(const FAuraQuantizedAttributeData& OldHealth) const;
 
 	UFUNCTION()
 	void OnRep_Mana(const FGameplayAttributeData& OldMana) const;
 
 	UFUNCTION()
-	void OnRep_Armor(const FGameplayAttributeData& OldArmor) const;
+	void OnRep_Armor(const FAuraQuantizedAttributeData& OldArmor) const;
 
 	UFUNCTION()
-	void OnRep_ArmorPenetration(const FGameplayAttributeData& OldArmorPenetration) const;
+	void OnRep_ArmorPenetration(const FAuraQuantizedAttributeData& OldArmorPenetration) const;
 
 	UFUNCTION()
-	void OnRep_BlockChance(const FGameplayAttributeData& OldBlockChance) const;
+	void OnRep_BlockChance(const FAuraQuantizedAttributeData& OldBlockChance) const;
 
 	UFUNCTION()
-	void OnRep_CriticalHitChance(const FGameplayAttributeData& OldCriticalHitChance) const;
+	void OnRep_CriticalHitChance(const FAuraQuantizedAttributeData& OldCriticalHitChance) const;
 
 	UFUNCTION()
-	void OnRep_CriticalHitDamage(const FGameplayAttributeData& OldCriticalHitDamage) const;
+	void OnRep_CriticalHitDamage(const FAuraQuantizedAttributeData& OldCriticalHitDamage) const;
 
 	UFUNCTION()
-	void OnRep_CriticalHitResistance(const FGameplayAttributeData& OldCriticalHitResistance) const;
+	void OnRep_CriticalHitResistance(const FAuraQuantizedAttributeData& OldCriticalHitResistance) const;
 
 	UFUNCTION()
-	void OnRep_HealthRegeneration(const FGameplayAttributeData& OldHealthRegeneration) const;
+	void OnRep_HealthRegeneration(const FAuraQuantizedAttributeData& OldHealthRegeneration) const;
 
 	UFUNCTION()
-	void OnRep_ManaRegeneration(const FGameplayAttributeData& OldManaRegeneration) const;
+	void OnRep_ManaRegeneration(const FAuraQuantizedAttributeData& OldManaRegeneration) const;
 
 	UFUNCTION()
-	void OnRep_MaxHealth(const FGameplayAttributeData& OldMaxHealth) const;
+	void OnRep_MaxHealth(const FAuraQuantizedAttributeData& OldMaxHealth) const;
 
 	UFUNCTION()
 	void OnRep_MaxMana(const FGameplayAttributeData& OldMaxMana) const;
 
 	UFUNCTION()
-	void OnRep_FireResistance(const FGameplayAttributeData& OldFireResistance) const;
+	void OnRep_FireResistance(const FAuraQuantizedAttributeData& OldFireResistance) const;
 
 	UFUNCTION()
-	void OnRep_LightningResistance(const FGameplayAttributeData& OldLightningResistance) const;
+	void OnRep_LightningResistance(const FAuraQuantizedAttributeData& OldLightningResistance) const;
 
 	UFUNCTION()
-	void OnRep_ArcaneResistance(const FGameplayAttributeData& OldArcaneResistance) const;
+	void OnRep_ArcaneResistance(const FAuraQuantizedAttributeData& OldArcaneResistance) const;
 
 	UFUNCTION()
-	void OnRep_PhysicalResistance(const FGameplayAttributeData& OldPhysicalResistance) const;
+	void OnRep_PhysicalResistance(const FAuraQuantizedAttributeData& OldPhysicalResistance) const;
 
 private:
 
+	/** Flags a replicated attribute for the push model replication, see `GetLifetimeReplicatedProps()`. */
+	void MarkAttributeDirty(const FGameplayAttribute& Attribute) const;
+
 	void HandleIncomingDamage(const FEffectProperties& Props);
 	void HandleIncomingXP(const FEffectProperties& Props);
 	void Debuff(const FEffectProperties& Props);
@@ -7,6 +7,7 @@
 #include "Engine/DataAsset.h"
 #include "CharacterClassInfo.generated.h"
 
+class FRealCurve;
 class UGameplayAbility;
 class UGameplayEffect;
 
@@ -33,6 +34,16 @@ struct FCharacterClassDefaultInfo
 	FScalableFloat XPReward = FScalableFloat();
 };
 
+/**
+ * Coefficients from `DamageCalculationCoefficients` curve table evaluated at a single level.
+ */
+struct FDamageCalculationCoefficients
+{
+	float ArmorPenetration = 0.0f;
+	float EffectiveArmor = 0.0f;
+	float CriticalHitResistance = 0.0f;
+};
+
 /**
  * 
  */
@@ -59,4 +70,28 @@ public:
 	TObjectPtr<UCurveTable> DamageCalculationCoefficients;
 
 	FCharacterClassDefaultInfo GetClassDefaultInfo(ECharacterClass CharacterClass);
+
+	/**
+	 * Returns the damage calculation coefficients for `Level`.
+	 *
+	 * The curves are looked up by name only once and baked into a table indexed by level, since this gets called for
+	 * every single damage execution. Levels beyond the last baked key are evaluated from the curves directly.
+	 */
+	FDamageCalculationCoefficients GetDamageCalculationCoefficients(int32 Level);
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+
+	void BakeDamageCalculationCoefficients();
+	void InvalidateDamageCalculationCoefficients();
+
+	const FRealCurve* ArmorPenetrationCurve = nullptr;
+	const FRealCurve* EffectiveArmorCurve = nullptr;
+	const FRealCurve* CriticalHitResistanceCurve = nullptr;
+
+	TArray<FDamageCalculationCoefficients> BakedDamageCalculationCoefficients;
+	bool bDamageCalculationCoefficientsBaked = false;
 };
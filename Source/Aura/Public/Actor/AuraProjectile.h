@@ -8,7 +8,7 @@
 #include "AuraProjectile.generated.h"
 
 class UNiagaraSystem;
-class UProjectileMovementComponent;
+class UAuraProjectileMovementComponent;
 class USphereComponent;
 
 UCLASS()
@@ -22,28 +22,67 @@ public:
 
 	virtual void Destroyed() override;
 
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<UProjectileMovementComponent> ProjectileMovement;
+	TObjectPtr<UAuraProjectileMovementComponent> ProjectileMovement;
 
 	UPROPERTY(BlueprintReadWrite, meta = (ExposeOnSpawn = true))
 	FDamageEffectParams DamageEffectParams;
 
-	UPROPERTY()
-	TObjectPtr<USceneComponent> HomingTargetSceneComponent;
+	/**
+	 * Used by `UAuraProjectilePoolSubsystem` on the server.
+	 * 
+	 * `Park()` deactivates the projectile (hidden, no collision, no movement, net dormant) and resets its
+	 * per-launch state, `Unpark()` activates it again at the given transform as if it was freshly spawned.
+	 */
+	void Park();
+	void Unpark(const FTransform& SpawnTransform);
+
+	bool IsParked() const { return bParked; }
 
 protected:
 
 	virtual void BeginPlay() override;
 
+	/** Return to the projectile pool instead of getting destroyed once the lifespan expires on the server. */
+	virtual void LifeSpanExpired() override;
+
 	UFUNCTION()
 	void OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
 	void OnHit();
 
+	/** Return to the projectile pool if there's one, otherwise destroy as usual. Server only. */
+	void ReleaseToPool();
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TObjectPtr<USphereComponent> Sphere;
 
 private:
+
+	bool bParked = false;
+
+	/**
+	 * Bumped on every `Park()` & `Unpark()`, so the projectile is parked while it's odd.
+	 *
+	 * Replicated instead of `bParked` so that the clients can play the cosmetic effects when a projectile is parked
+	 * (like they do in `Destroyed()` otherwise) and restore the looping sound when it's reused, even when a park & a
+	 * relaunch happen within the same net update & `bParked` itself would look unchanged.
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_ParkSerial)
+	uint8 ParkSerial = 0;
+
+	UFUNCTION()
+	void OnRep_ParkSerial(uint8 OldParkSerial);
+
+	/** Local (non-replicated) part of parking & unparking, shared by the server and `OnRep_ParkSerial()`. */
+	void DeactivateProjectile();
+	void ActivateProjectile();
+
+	void ResetLaunchState();
+	void StartLoopingSound();
+
 	/**
 	 * On the client, either `OnSphereOverlap()` function will be called first or the act of destruction (with `Destroyed()`)
 	 * will replicate down to client will happen first.
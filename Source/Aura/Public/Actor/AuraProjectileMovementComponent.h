@@ -0,0 +1,36 @@
+// Copyright - Amey Chavan
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "AuraProjectileMovementComponent.generated.h"
+
+/**
+ * Projectile movement which can also home towards a fixed world location.
+ *
+ * The engine's homing only works with a `HomingTargetComponent`, so to home towards a point we used to create
+ * a new `USceneComponent` for every projectile just to hold that location. Here the location is stored directly
+ * and used whenever homing is enabled but there's no valid `HomingTargetComponent`.
+ */
+UCLASS()
+class AURA_API UAuraProjectileMovementComponent : public UProjectileMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	void SetHomingTargetLocation(const FVector& InHomingTargetLocation);
+	void ClearHomingTargetLocation();
+
+protected:
+
+	virtual FVector ComputeAcceleration(const FVector& InVelocity, float DeltaTime) const override;
+	virtual FVector ComputeHomingAcceleration(const FVector& InVelocity, float DeltaTime) const override;
+
+private:
+
+	bool bHomingToLocation = false;
+
+	FVector HomingTargetLocation = FVector::ZeroVector;
+};
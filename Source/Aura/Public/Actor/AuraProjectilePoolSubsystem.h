@@ -0,0 +1,55 @@
+// Copyright - Amey Chavan
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraProjectilePoolSubsystem.generated.h"
+
+class AAuraProjectile;
+
+/**
+ * Server side pool of `AAuraProjectile` actors, one bucket per projectile class.
+ *
+ * Instead of spawning a new replicated actor for every bolt and destroying it on impact, projectiles are "parked"
+ * (hidden, collision & movement disabled, net dormant) when they hit something or their lifespan expires,
+ * and handed out again by `AcquireProjectile()` on the next cast.
+ *
+ * Usage mirrors the deferred spawn flow,
+ *
+ *		AAuraProjectile* Projectile = Pool->AcquireProjectile(ProjectileClass, SpawnTransform, Owner, Instigator);
+ *		Projectile->DamageEffectParams = ...;
+ *		Pool->LaunchProjectile(Projectile, SpawnTransform);
+ */
+UCLASS()
+class AURA_API UAuraProjectilePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Returns a parked projectile of exactly `ProjectileClass` if there's one, otherwise deferred spawns a new one.
+	 * The returned projectile is not active yet, `LaunchProjectile()` must be called once it's configured.
+	 */
+	AAuraProjectile* AcquireProjectile(TSubclassOf<AAuraProjectile> ProjectileClass, const FTransform& SpawnTransform, AActor* Owner, APawn* Instigator);
+
+	/** Finishes spawning a newly spawned projectile or re-activates a reused one at `SpawnTransform`. */
+	void LaunchProjectile(AAuraProjectile* Projectile, const FTransform& SpawnTransform);
+
+	/** Parks the projectile for later reuse, or destroys it if the pool for its class is already full. */
+	void ReleaseProjectile(AAuraProjectile* Projectile);
+
+private:
+
+	/**
+	 * Parked projectiles are still owned by the level, so weak pointers are enough here;
+	 * if anything else destroys a parked projectile it simply gets skipped on acquire.
+	 */
+	TMap<TSubclassOf<AAuraProjectile>, TArray<TWeakObjectPtr<AAuraProjectile>>> ParkedProjectiles;
+
+	/** Upper limit of parked projectiles per class, anything above that is destroyed as before. */
+	static constexpr int32 MaxParkedProjectilesPerClass = 32;
+};
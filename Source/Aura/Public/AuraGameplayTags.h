@@ -35,6 +35,7 @@ public:
 
  FGameplayTag Attributes_Meta_IncomingXP;
 
+ FGameplayTag InputTag;
  FGameplayTag InputTag_LMB;
  FGameplayTag InputTag_RMB;
  FGameplayTag InputTag_1;
@@ -65,6 +66,7 @@ public:
  FGameplayTag Debuff_Duration;
  FGameplayTag Debuff_Frequency;
 
+ FGameplayTag Abilities;
  FGameplayTag Abilities_None;
 
  FGameplayTag Abilities_Attack;
@@ -72,6 +74,7 @@ public:
 
  FGameplayTag Abilities_HitReact;
 
+ FGameplayTag Abilities_Status;
  FGameplayTag Abilities_Status_Locked;
  FGameplayTag Abilities_Status_Eligible;
  FGameplayTag Abilities_Status_Unlocked;
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AI/AuraAISignificanceSubsystem.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"
 #include "Character/AuraCharacterBase.h"
 #include "Interaction/EnemyInterface.h"
 #include "UI/WidgetController/OverlayWidgetController.h"
@@ -26,8 +28,18 @@ public:
 
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void PossessedBy(AController* NewController) override;
 
+	/**
+	 * Throttles the behavior tree, movement & animation ticks, as well as the replication (net update frequency & dormancy)
+	 * for the given significance, see `UAuraAISignificanceSubsystem`.
+	 */
+	void SetAISignificance(EAuraAISignificance NewSignificance);
+
+	EAuraAISignificance GetAISignificance() const { return AISignificance; }
+
 	//~ Begin Enemy Interface.
 
 	virtual void HighlightActor() override;
@@ -80,4 +92,41 @@ protected:
 
 	UPROPERTY()
 	TObjectPtr<AAuraAIController> AuraAIController;
+
+private:
+
+	/**
+	 * Blackboard key IDs, resolved once after the Blackboard gets initialized in `PossessedBy()`,
+	 * so that the frequent writes (e.g. from `HitReactTagChanged()`) don't look up the key by name every time.
+	 */
+	FBlackboard::FKey HitReactingKey = FBlackboard::InvalidKey;
+	FBlackboard::FKey RangedAttackerKey = FBlackboard::InvalidKey;
+	FBlackboard::FKey DeadKey = FBlackboard::InvalidKey;
+	FBlackboard::FKey StunnedKey = FBlackboard::InvalidKey;
+
+	EAuraAISignificance AISignificance = EAuraAISignificance::High;
+
+	/** Net update frequency as set up on the class, restored for the `High` significance. */
+	float DefaultNetUpdateFrequency = 100.0f;
+
+	/** Net cull distance as set up on the class, restored for the `High` & `Medium` significances. */
+	float DefaultNetCullDistanceSquared = 225000000.0f;
+
+	/** Dead bodies only wait for their `LifeSpan` to run out, see `Die()`. */
+	static constexpr float DeadNetUpdateFrequency = 1.0f;
+
+	/** Past this distance a client drops the dead body early instead of waiting for its destruction. */
+	static constexpr float DeadNetCullDistance = 4000.0f;
+
+	/** Sets the net dormancy on the server, keeping track of the dormant enemies for the stats. */
+	void SetEnemyNetDormancy(ENetDormancy NewDormancy);
+
+	/** Replicates a change of a dormant enemy without waking it up. */
+	void FlushNetDormancyIfDormant();
+
+	/** Raises the enemy to the `High` significance on the server (e.g. on aggro or damage), unless it's dead. */
+	void WakeUp();
+
+	void CacheBlackboardKeys();
+	void SetBlackboardValueAsBool(FBlackboard::FKey KeyID, bool bValue) const;
 };
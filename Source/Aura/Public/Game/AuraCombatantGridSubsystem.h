@@ -0,0 +1,92 @@
+// Copyright - Amey Chavan
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "Interaction/CombatInterface.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraCombatantGridSubsystem.generated.h"
+
+struct FAuraCombatantLocation
+{
+	AActor* Combatant = nullptr;
+	FVector Location = FVector::ZeroVector;
+};
+
+/**
+ * Keeps every live `ICombatInterface` actor of the world in a uniform 2D grid (on the XY plane), so that radius queries
+ * only look at the combatants in the nearby cells instead of running a physics overlap against all dynamic objects.
+ *
+ * Combatants register themselves on `BeginPlay()` and unregister on `EndPlay()`. Meanwhile the grid follows them through
+ * their root component's `TransformUpdated` event and drops them as soon as their `OnDeathDelegate` is broadcast,
+ * so the grid only ever contains live combatants.
+ */
+UCLASS()
+class AURA_API UAuraCombatantGridSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Deinitialize() override;
+
+	void RegisterCombatant(AActor* Combatant);
+	void UnregisterCombatant(AActor* Combatant);
+
+	/**
+	 * Collects the live combatants touching the sphere at `SphereOrigin` with `Radius`, each of them only once.
+	 * A combatant's collision is treated as an upright capsule (its simple collision cylinder with rounded ends),
+	 * so e.g. a sphere just above a combatant's head touches it just like the physics overlap would.
+	 *
+	 * @param FriendlyToActor If set, only the combatants which are NOT friends of this actor are collected (see `UAuraAbilitySystemLibrary::IsNotFriend()`).
+	 * @param OutLocations If set, the tracked location of each collected combatant is appended in the same order as `OutCombatants`.
+	 */
+	void GetLiveCombatantsWithinRadius(TArray<AActor*>& OutCombatants, const TArray<AActor*>& ActorsToIgnore, float Radius,
+	                                   const FVector& SphereOrigin, AActor* FriendlyToActor = nullptr, TArray<FVector>* OutLocations = nullptr) const;
+
+	/**
+	 * Live combatants of `Team` with their locations.
+	 * Gathered at most once per frame for each team and shared by all the callers during that frame,
+	 * e.g. all the enemies' behavior trees looking for the nearest player.
+	 */
+	TConstArrayView<FAuraCombatantLocation> GetLiveCombatantsOfTeam(EAuraTeam Team) const;
+
+private:
+
+	struct FCombatantEntry
+	{
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		FVector Location = FVector::ZeroVector;
+		float CollisionRadius = 0.0f;
+		float CollisionHalfHeight = 0.0f;
+		EAuraTeam Team = EAuraTeam::None;
+		FDelegateHandle TransformUpdatedHandle;
+	};
+
+	UFUNCTION()
+	void OnCombatantDied(AActor* DeadActor);
+
+	void OnCombatantTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	FIntPoint GetCellFromLocation(const FVector& Location) const;
+
+	/**
+	 * Raw pointers are fine in here, the combatants are always removed in their `EndPlay()` before they're destroyed.
+	 */
+	TMap<AActor*, FCombatantEntry> Combatants;
+	TMap<FIntPoint, TArray<AActor*, TInlineAllocator<8>>> Cells;
+
+	/** Largest collision radius of the registered combatants, used to widen the range of cells being checked. */
+	float MaxCombatantCollisionRadius = 0.0f;
+
+	struct FTeamCache
+	{
+		TArray<FAuraCombatantLocation> Combatants;
+		uint64 Frame = TNumericLimits<uint64>::Max();
+	};
+
+	mutable FTeamCache TeamCaches[static_cast<uint8>(EAuraTeam::MAX)];
+
+	static constexpr float CellSize = 400.0f;
+};
@@ -0,0 +1,69 @@
+// Copyright - Amey Chavan
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraDamageNumberSubsystem.generated.h"
+
+/** One (possibly coalesced) damage number as it's sent down to the clients. */
+USTRUCT()
+struct FAuraDamageNumber
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<ACharacter> TargetCharacter = nullptr;
+
+	UPROPERTY()
+	float Damage = 0.0f;
+
+	/** Number of hits coalesced into this damage number, saturated at 255. */
+	UPROPERTY()
+	uint8 HitCount = 0;
+
+	UPROPERTY()
+	uint8 bBlockedHit : 1;
+
+	UPROPERTY()
+	uint8 bCriticalHit : 1;
+
+	FAuraDamageNumber()
+		: bBlockedHit(false)
+		, bCriticalHit(false)
+	{
+	}
+};
+
+/**
+ * Server side buffer of the damage numbers to show on the clients.
+ *
+ * Every hit used to send its own reliable `ShowDamageNumber` client RPC to every player controller,
+ * so an AoE hitting many targets (or a target getting hit many times in a frame) quickly used up the RPC budget.
+ * Now the hits are coalesced per target during the frame (total damage, blocked/critical flags, hit count)
+ * and flushed once at the end of the frame as batched `ClientShowDamageNumbers` RPCs, each player controller only
+ * getting the damage numbers of the targets relevant to it (see `UAuraReplicationGraph::IsActorRelevantToViewer()`)
+ * and at most `MaxDamageNumbersPerRPC` of them per RPC.
+ */
+UCLASS()
+class AURA_API UAuraDamageNumberSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	void AddDamageNumber(ACharacter* TargetCharacter, float Damage, bool bBlockedHit, bool bCriticalHit);
+
+private:
+
+	void FlushDamageNumbers();
+
+	TMap<TWeakObjectPtr<ACharacter>, FAuraDamageNumber> PendingDamageNumbers;
+
+	/** Keeps a single reliable RPC small, a bigger batch is split into several RPCs. */
+	static constexpr int32 MaxDamageNumbersPerRPC = 32;
+};
@@ -0,0 +1,121 @@
+// Copyright - Amey Chavan
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "AuraReplicationGraph.generated.h"
+
+/** How the actors of a class are routed to the nodes of `UAuraReplicationGraph`. */
+UENUM()
+enum class EAuraClassRepNodeMapping : uint8
+{
+	/** Not routed to any global node, i.e. the player controllers which the per connection node always replicates. */
+	NotRouted,
+
+	/** Replicated to every connection, e.g. the game state & the player states. */
+	RelevantAllConnections,
+
+	/** Only replicated to the connection owning the actor, for the other `bOnlyRelevantToOwner` actors. */
+	RelevantOwnerConnection,
+
+	/** Spatialized into the grid once, for the replicated actors which don't move. */
+	Spatialize_Static,
+
+	/** Spatialized into the grid & updated every frame, e.g. the player characters. */
+	Spatialize_Dynamic,
+
+	/** Spatialized as static while net dormant & as dynamic while awake, e.g. the enemies & (pooled) projectiles. */
+	Spatialize_Dormancy
+};
+
+/**
+ * Replication graph for Aura, set as the replication driver of the `IpNetDriver` in `DefaultEngine.ini`.
+ *
+ * Instead of the net driver checking the relevancy of every replicated actor against every connection each frame,
+ * actors are routed once by their class (see `EAuraClassRepNodeMapping`) to a 2D spatial grid, to an always relevant
+ * list, or to the per connection node, & each connection only gathers the grid cells around its viewers.
+ */
+UCLASS(Transient, Config = Engine)
+class AURA_API UAuraReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual int32 ServerReplicateActors(float DeltaSeconds) override;
+
+	/**
+	 * The graph reads an actor's `NetUpdateFrequency` only once, when the actor is added,
+	 * so actors changing it at runtime (e.g. `AAuraEnemy::SetAISignificance()`) need to call this afterwards.
+	 * Does nothing when the actor's net driver doesn't use this graph.
+	 */
+	static void NotifyNetUpdateFrequencyChanged(const AActor* Actor);
+
+	/**
+	 * Same as `NotifyNetUpdateFrequencyChanged()` for the actor's `NetCullDistanceSquared`, which is also copied to the actor's
+	 * info of every connection & decides which grid cells a dormant (statically spatialized) actor is placed in.
+	 */
+	static void NotifyNetCullDistanceChanged(AActor* Actor);
+
+	/**
+	 * Whether `Actor` is relevant to the connection of `Viewer` at `ViewLocation`, by the same cull distance the graph's
+	 * grid uses for the actor. Falls back to `AActor::IsNetRelevantFor()` when the net driver doesn't use this graph.
+	 */
+	static bool IsActorRelevantToViewer(const AActor* Actor, const APlayerController* Viewer, const FVector& ViewLocation);
+
+	/** Actors routed as `RelevantOwnerConnection`, gathered by `UAuraReplicationGraphNode_AlwaysRelevant_ForConnection`. */
+	const TArray<AActor*>& GetOwnerOnlyActors() const { return OwnerOnlyActors; }
+
+protected:
+
+	UPROPERTY(Config)
+	float GridCellSize = 10000.0f;
+
+	/** Minimum X & Y of the grid, the actors below it all end up in the first row or column of cells. */
+	UPROPERTY(Config)
+	FVector2D GridSpatialBias = FVector2D(-UE_OLD_WORLD_MAX, -UE_OLD_WORLD_MAX);
+
+private:
+
+	EAuraClassRepNodeMapping GetMappingPolicy(UClass* Class);
+	EAuraClassRepNodeMapping ComputeMappingPolicy(const UClass* Class) const;
+	void InitClassReplicationInfo(FClassReplicationInfo& Info, const UClass* Class, bool bSpatialize) const;
+	uint8 GetReplicationPeriodFrame(float NetUpdateFrequency) const;
+
+	/** Looked up by class hierarchy, so e.g. the Blueprint enemies use the policy of `AAuraEnemy`. */
+	TClassMap<EAuraClassRepNodeMapping> ClassRepNodePolicies;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+	/** Raw pointers are fine, the actors are removed through `RouteRemoveNetworkActorToNodes()` before they're destroyed. */
+	TArray<AActor*> OwnerOnlyActors;
+};
+
+/**
+ * On top of the connection's player controller & view targets, keeps the player's own pawn relevant to them
+ * (e.g. for the HUD's health & mana) even while the view target is something else,
+ * as well as the `RelevantOwnerConnection` actors currently owned by the connection.
+ */
+UCLASS()
+class AURA_API UAuraReplicationGraphNode_AlwaysRelevant_ForConnection : public UReplicationGraphNode_AlwaysRelevant_ForConnection
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+private:
+
+	FActorRepListRefView OwnerActorList;
+};
@@ -11,6 +11,37 @@
 class UAbilitySystemComponent;
 class UNiagaraSystem;
 
+UENUM(BlueprintType)
+enum class EAuraTeam : uint8
+{
+	None,
+	Player,
+	Enemy,
+
+	MAX UMETA(Hidden)
+};
+
+namespace AuraTeam
+{
+	/**
+	 * Friend/enemy matrix of the teams, bit `B` of `FriendMasks[A]` is set when team `A` is friends with team `B`.
+	 * Same as the old "Player"/"Enemy" actor tag checks, players are friends with players and enemies with enemies,
+	 * while an actor without any team is nobody's friend.
+	 */
+	inline constexpr uint8 FriendMasks[] =
+	{
+		/* None */		0,
+		/* Player */	1 << static_cast<uint8>(EAuraTeam::Player),
+		/* Enemy */		1 << static_cast<uint8>(EAuraTeam::Enemy)
+	};
+	static_assert(UE_ARRAY_COUNT(FriendMasks) == static_cast<uint8>(EAuraTeam::MAX), "Every team needs an entry in the FriendMasks.");
+
+	constexpr bool AreFriends(EAuraTeam FirstTeam, EAuraTeam SecondTeam)
+	{
+		return (FriendMasks[static_cast<uint8>(FirstTeam)] & (1 << static_cast<uint8>(SecondTeam))) != 0;
+	}
+}
+
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnASCRegistered, UAbilitySystemComponent*);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDeathSignature, AActor*, DeadActor);
 
@@ -95,6 +126,8 @@ public:
 	virtual FOnASCRegistered& GetOnASCRegisteredDelegate() = 0;
 	virtual FOnDeathSignature& GetOnDeathDelegate() = 0;
 
+	virtual EAuraTeam GetTeam() const = 0;
+
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable)
 	void SetInShockLoop(bool bInLoop);
 
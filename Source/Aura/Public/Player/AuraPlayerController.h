@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "AI/AuraSplinePathFollower.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "Game/AuraDamageNumberSubsystem.h"
 #include "GameFramework/PlayerController.h"
 #include "AuraPlayerController.generated.h"
 
@@ -31,8 +34,21 @@ public:
 	AAuraPlayerController();
 	virtual void PlayerTick(float DeltaTime) override;
 
+	/** Batch of the damage numbers coalesced by `UAuraDamageNumberSubsystem` on the server, only for the targets relevant to this client. */
 	UFUNCTION(Client, Reliable)
-	void ShowDamageNumber(float DamageAmount, ACharacter* TargetCharacter, bool bBlockedHit, bool bCriticalHit);
+	void ClientShowDamageNumbers(const TArray<FAuraDamageNumber>& DamageNumbers);
+
+	/**
+	 * Hit result under the mouse cursor for `TraceChannel`, cached per channel.
+	 *
+	 * The trace is only done again when the mouse position or the camera view changed since the last trace on that channel,
+	 * or when the cached hit is older than `CursorTraceMaxStaleTime` (so that actors moving under a still cursor are picked up).
+	 *
+	 * @param bThrottle If `true`, also don't trace more often than `CursorTraceMaxRate`.
+	 * @param bOutUpdated If given, set to whether the cached hit was updated, i.e. a new trace was done
+	 * or the hit was cleared for the lack of a mouse.
+	 */
+	const FHitResult& GetCachedHitResultUnderCursor(ECollisionChannel TraceChannel, bool bThrottle = false, bool* bOutUpdated = nullptr);
 
 	UFUNCTION(BlueprintCallable)
 	void ShowMagicCircle(UMaterialInterface* DecalMaterial = nullptr);
@@ -78,6 +94,27 @@ private:
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<USplineComponent> Spline;
 
+	FAuraSplinePathFollower SplinePathFollower;
+
+	/**
+	 * If `true`, the click-to-move path is requested asynchronously from the navigation system
+	 * instead of being found synchronously on the game thread, the auto-run starts once the path is found.
+	 */
+	UPROPERTY(EditDefaultsOnly)
+	bool bUseAsyncPathfinding = true;
+
+	/** ID of the pending async click-to-move path query, zero if there's none. */
+	uint32 PendingPathQueryID = 0;
+
+	double PendingPathRequestTime = 0.0;
+
+	void RequestPathToCachedDestination(const FVector& PathStart);
+	void CancelPendingPathRequest();
+	void OnAsyncPathFound(uint32 QueryID, ENavigationQueryResult::Type Result, FNavPathSharedPtr NavPath);
+
+	/** Fills the spline with the path points & starts auto-running towards the last one. */
+	void FollowPathPoints(const TArray<FVector>& PathPoints);
+
 	UPROPERTY(EditDefaultsOnly)
 	TObjectPtr<UNiagaraSystem> ClickNiagaraSystem;
 
@@ -89,6 +126,27 @@ private:
 
 	void CursorTrace();
 
+	struct FCursorTraceCache
+	{
+		FHitResult Hit;
+		FVector2D MousePosition = FVector2D::ZeroVector;
+		FVector CameraLocation = FVector::ZeroVector;
+		FRotator CameraRotation = FRotator::ZeroRotator;
+		float CameraFOV = 0.0f;
+		double TraceTime = 0.0;
+		bool bValid = false;
+	};
+
+	TMap<ECollisionChannel, FCursorTraceCache> CursorTraceCaches;
+
+	/** Maximum cursor traces per second done by `CursorTrace()`, zero or less to trace every frame (when needed). */
+	UPROPERTY(EditDefaultsOnly, Category = "Cursor Trace")
+	float CursorTraceMaxRate = 30.0f;
+
+	/** Seconds after which the cached cursor hit is traced again, even if the mouse & camera didn't move. */
+	UPROPERTY(EditDefaultsOnly, Category = "Cursor Trace")
+	float CursorTraceMaxStaleTime = 0.1f;
+
 	void AbilityInputTagPressed(FGameplayTag InputTag);
 	void AbilityInputTagReleased(FGameplayTag InputTag);
 	void AbilityInputTagHeld(FGameplayTag InputTag);
@@ -99,6 +157,25 @@ private:
 	UPROPERTY(EditDefaultsOnly)
 	TSubclassOf<UDamageTextComponent> DamageTextComponentClass;
 
+	void ShowDamageNumber(float DamageAmount, ACharacter* TargetCharacter, bool bBlockedHit, bool bCriticalHit, int32 HitCount);
+
+	/**
+	 * Client side ring buffer of the damage text components, reused in least recently used order.
+	 *
+	 * `NextDamageTextIndex` always points to the least recently used one. It's reused if it's done showing,
+	 * otherwise a new one is added in front of it until `MaxDamageTextComponents` is reached,
+	 * after that the least recently used one is reused even if it's still showing.
+	 */
+	UDamageTextComponent* AcquireDamageTextComponent();
+
+	UPROPERTY(EditDefaultsOnly)
+	int32 MaxDamageTextComponents = 32;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UDamageTextComponent>> DamageTextComponents;
+
+	int32 NextDamageTextIndex = 0;
+
 	UPROPERTY(EditDefaultsOnly)
 	TSubclassOf<AMagicCircle> MagicCircleClass;
 
@@ -18,4 +18,33 @@ public:
 
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable)
 	void SetDamageText(float Damage, bool bBlockedHit, bool bCriticalHit);
+
+	/**
+	 * Pooled damage texts are reused by `AAuraPlayerController` instead of being created for each damage number.
+	 *
+	 * The widget animation destroys the component once it's done, so for a pooled component that `DestroyComponent()`
+	 * call (or `FinishDamageText()`) only hides it until it's shown again. Showing it again also cancels whatever latent
+	 * action (e.g. the `Delay` before that call) is still pending from the previous show.
+	 */
+	void SetPooled(bool bInPooled) { bPooled = bInPooled; }
+
+	void ShowDamageText(float Damage, bool bBlockedHit, bool bCriticalHit, int32 InHitCount = 1);
+
+	UFUNCTION(BlueprintCallable)
+	void FinishDamageText();
+
+	bool IsShowingDamageText() const { return bShowingDamageText; }
+
+	virtual void DestroyComponent(bool bPromoteChildren = false) override;
+
+protected:
+
+	/** Number of hits the server coalesced into the damage being shown, e.g. for the widget to show a "x3" next to it. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 HitCount = 1;
+
+private:
+
+	bool bPooled = false;
+	bool bShowingDamageText = false;
 };